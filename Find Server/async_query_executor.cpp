@@ -0,0 +1,97 @@
+#include "async_query_executor.h"
+
+#include <algorithm>
+
+using namespace std::string_literals;
+
+AsyncQueryExecutor::AsyncQueryExecutor(const SearchServer& search_server, size_t thread_count, size_t max_queue_size)
+    : server_(search_server), max_queue_size_(max_queue_size) {
+
+    if (thread_count == 0) throw std::invalid_argument("Пул должен содержать хотя бы один поток"s);
+
+    workers_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+AsyncQueryExecutor::~AsyncQueryExecutor() {
+    {
+        std::lock_guard guard(lock_);
+        stopped_ = true;
+    }
+    has_task_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+std::future<std::vector<Document>> AsyncQueryExecutor::FindTopDocumentsAsync(const std::string& raw_query,
+    DocumentStatus status, Clock::duration timeout) {
+
+    const auto now = Clock::now();
+    const auto deadline = (timeout >= Clock::time_point::max() - now) ? Clock::time_point::max() : now + timeout;
+
+    std::future<std::vector<Document>> out;
+    {
+        std::lock_guard guard(lock_);
+        if (tasks_.size() >= max_queue_size_) {
+            ++metrics_.rejected;
+            throw QueueOverflowError("Очередь запросов переполнена"s);
+        }
+
+        tasks_.push_back({ raw_query, status, now, deadline, {} });
+        out = tasks_.back().result.get_future();
+
+        ++metrics_.accepted;
+        metrics_.max_queue_depth = std::max(metrics_.max_queue_depth, tasks_.size());
+    }
+    has_task_.notify_one();
+
+    return out;
+}
+
+QueryExecutorMetrics AsyncQueryExecutor::GetMetrics() const {
+    std::lock_guard guard(lock_);
+    QueryExecutorMetrics out = metrics_;
+    out.queue_depth = tasks_.size();
+    return out;
+}
+
+void AsyncQueryExecutor::WorkerLoop() {
+    using namespace std::chrono;
+
+    while (true) {
+        Task task;
+        {
+            std::unique_lock guard(lock_);
+            has_task_.wait(guard, [this]() { return stopped_ || !tasks_.empty(); });
+            if (tasks_.empty()) return;
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+
+            const auto now = Clock::now();
+            const auto wait = duration_cast<microseconds>(now - task.enqueued);
+            metrics_.total_wait += wait;
+            metrics_.max_wait = std::max(metrics_.max_wait, wait);
+
+            if (now > task.deadline) {
+                ++metrics_.expired;
+                task.result.set_exception(std::make_exception_ptr(DeadlineExceededError("Истекло время ожидания запроса"s)));
+                continue;
+            }
+        }
+
+        try {
+            task.result.set_value(server_.FindTopDocuments(task.raw_query, task.status));
+        }
+        catch (...) {
+            task.result.set_exception(std::current_exception());
+        }
+
+        std::lock_guard guard(lock_);
+        ++metrics_.completed;
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "search_server.h"
+#include "document.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+class QueueOverflowError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+class DeadlineExceededError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+struct QueryExecutorMetrics {
+    size_t queue_depth = 0;
+    size_t max_queue_depth = 0;
+    size_t accepted = 0;
+    size_t rejected = 0;
+    size_t expired = 0;
+    size_t completed = 0;
+    std::chrono::microseconds total_wait{ 0 };
+    std::chrono::microseconds max_wait{ 0 };
+};
+
+class AsyncQueryExecutor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    AsyncQueryExecutor(const SearchServer& search_server, size_t thread_count, size_t max_queue_size);
+
+    AsyncQueryExecutor(const AsyncQueryExecutor&) = delete;
+    AsyncQueryExecutor& operator=(const AsyncQueryExecutor&) = delete;
+
+    ~AsyncQueryExecutor();
+
+    std::future<std::vector<Document>> FindTopDocumentsAsync(const std::string& raw_query,
+        DocumentStatus status = DocumentStatus::ACTUAL, Clock::duration timeout = Clock::duration::max());
+
+    QueryExecutorMetrics GetMetrics() const;
+
+private:
+    struct Task {
+        std::string raw_query;
+        DocumentStatus status;
+        Clock::time_point enqueued;
+        Clock::time_point deadline;
+        std::promise<std::vector<Document>> result;
+    };
+
+    const SearchServer& server_;
+    const size_t max_queue_size_;
+
+    mutable std::mutex lock_;
+    std::condition_variable has_task_;
+    std::deque<Task> tasks_;
+    bool stopped_ = false;
+    QueryExecutorMetrics metrics_;
+
+    std::vector<std::thread> workers_;
+
+    void WorkerLoop();
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity) {}
+
+    bool Push(T value) {
+        std::unique_lock guard(lock_);
+        not_full_.wait(guard, [this]() { return closed_ || items_.size() < capacity_; });
+        if (closed_) return false;
+
+        items_.push_back(std::move(value));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    // Не ждет места: при полной или закрытой очереди возвращает false и оставляет value нетронутым
+    bool TryPush(T& value) {
+        std::lock_guard guard(lock_);
+        if (closed_ || items_.size() >= capacity_) return false;
+
+        items_.push_back(std::move(value));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    std::optional<T> Pop() {
+        std::unique_lock guard(lock_);
+        not_empty_.wait(guard, [this]() { return closed_ || !items_.empty(); });
+        if (items_.empty()) return std::nullopt;
+
+        T value = std::move(items_.front());
+        items_.pop_front();
+        not_full_.notify_one();
+        return value;
+    }
+
+    void Close() {
+        std::lock_guard guard(lock_);
+        closed_ = true;
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+private:
+    const size_t capacity_;
+    std::mutex lock_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<T> items_;
+    bool closed_ = false;
+};
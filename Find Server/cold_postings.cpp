@@ -0,0 +1,210 @@
+#include "cold_postings.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std::string_literals;
+
+double ColdCacheMetrics::GetHitRate() const {
+    const size_t requests = hits + misses;
+    return requests > 0 ? static_cast<double>(hits) / requests : 0.0;
+}
+
+std::ostream& operator<<(std::ostream& out, const ColdCacheMetrics& metrics) {
+    out << "hits: "s << metrics.hits
+        << ", misses: "s << metrics.misses
+        << ", hit rate: "s << metrics.GetHitRate() * 100 << "%"s
+        << ", evictions: "s << metrics.evictions
+        << ", prefetched pages: "s << metrics.prefetched_pages
+        << ", read: "s << metrics.bytes_read
+        << ", cached: "s << metrics.cached_bytes
+        << ", file: "s << metrics.file_bytes
+        << ", live: "s << metrics.live_bytes;
+    return out;
+}
+
+ColdPostingStore::ColdPostingStore(const ColdStorageSettings& settings)
+    : path_(settings.path)
+    , cache_bytes_(settings.cache_bytes)
+    , page_size_(settings.page_size)
+    , prefetch_pages_(std::max<size_t>(1, settings.prefetch_pages)) {
+
+    if (page_size_ == 0 || page_size_ % sizeof(ColdPosting) != 0) throw std::invalid_argument("Размер страницы должен быть кратен размеру записи"s);
+
+#if defined(_WIN32)
+    file_.open(path_, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_) throw std::runtime_error("Не удалось открыть файл "s + path_);
+#else
+    fd_ = open(path_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd_ < 0) throw std::runtime_error("Не удалось открыть файл "s + path_);
+#endif
+}
+
+ColdPostingStore::~ColdPostingStore() {
+#if defined(_WIN32)
+    file_.close();
+#else
+    close(fd_);
+#endif
+    std::remove(path_.c_str());
+}
+
+ColdPostingRef ColdPostingStore::Append(const std::array<std::vector<ColdPosting>, DOCUMENT_STATUS_COUNT>& partitions) {
+    std::lock_guard guard(cache_lock_);
+
+    ColdPostingRef ref;
+    ref.offset = file_bytes_;
+
+    for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+        const std::vector<ColdPosting>& partition = partitions[status];
+        ref.counts[status] = static_cast<uint32_t>(partition.size());
+        if (partition.empty()) continue;
+
+        const size_t size = partition.size() * sizeof(ColdPosting);
+        WriteAt(file_bytes_, reinterpret_cast<const char*>(partition.data()), size);
+        file_bytes_ += size;
+    }
+
+    metrics_.file_bytes = file_bytes_;
+    metrics_.live_bytes += static_cast<size_t>(file_bytes_ - ref.offset);
+    return ref;
+}
+
+void ColdPostingStore::Release(const ColdPostingRef& ref) {
+    std::lock_guard guard(cache_lock_);
+    metrics_.live_bytes -= ref.GetDocumentCount() * sizeof(ColdPosting);
+}
+
+std::optional<uint32_t> ColdPostingStore::Find(uint64_t offset, size_t count, int document_id) const {
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        const ColdPosting posting = ReadPosting(offset + middle * sizeof(ColdPosting));
+        if (posting.document_id == document_id) return posting.term_count;
+        if (posting.document_id < document_id) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return std::nullopt;
+}
+
+ColdCacheMetrics ColdPostingStore::GetMetrics() const {
+    std::lock_guard guard(cache_lock_);
+    return metrics_;
+}
+
+ColdPosting ColdPostingStore::ReadPosting(uint64_t position) const {
+    const size_t page_index = static_cast<size_t>(position / page_size_);
+    const std::shared_ptr<const Page> page = GetPage(page_index, position + sizeof(ColdPosting));
+
+    ColdPosting posting;
+    std::memcpy(&posting, page->data() + (position - static_cast<uint64_t>(page_index) * page_size_), sizeof(ColdPosting));
+    return posting;
+}
+
+std::shared_ptr<const ColdPostingStore::Page> ColdPostingStore::GetPage(size_t page_index, uint64_t read_limit) const {
+    const uint64_t start = static_cast<uint64_t>(page_index) * page_size_;
+    size_t run = 1;
+    size_t size = 0;
+    {
+        std::lock_guard guard(cache_lock_);
+        const auto it = pages_.find(page_index);
+        if (it != pages_.end()) {
+            // Неполная страница из хвоста файла устаревает, если за ней дописали данные
+            if (it->second.page->size() == page_size_ || start + it->second.page->size() >= file_bytes_) {
+                ++metrics_.hits;
+                lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+                return it->second.page;
+            }
+            metrics_.cached_bytes -= it->second.page->size();
+            lru_.erase(it->second.lru_position);
+            pages_.erase(it);
+        }
+        ++metrics_.misses;
+
+        // Дочитываем следующие страницы списка одним запросом, пока они не в кэше
+        const uint64_t limit = std::min<uint64_t>(read_limit, file_bytes_);
+        while (run < prefetch_pages_
+            && start + run * page_size_ < limit
+            && pages_.count(page_index + run) == 0) {
+            ++run;
+        }
+        size = static_cast<size_t>(std::min<uint64_t>(run * page_size_, file_bytes_ - start));
+    }
+
+    std::vector<char> buffer(size);
+    ReadAt(start, buffer.data(), size);
+
+    std::shared_ptr<const Page> requested;
+    std::lock_guard guard(cache_lock_);
+    metrics_.bytes_read += size;
+    metrics_.prefetched_pages += run - 1;
+
+    for (size_t i = 0; i < run; ++i) {
+        const size_t begin = i * page_size_;
+        const size_t end = std::min(size, begin + page_size_);
+        auto page = std::make_shared<const Page>(buffer.begin() + begin, buffer.begin() + end);
+
+        auto [it, inserted] = pages_.try_emplace(page_index + i);
+        if (inserted) {
+            lru_.push_front(page_index + i);
+            it->second = { std::move(page), lru_.begin() };
+            metrics_.cached_bytes += it->second.page->size();
+        }
+        if (i == 0) {
+            requested = it->second.page;
+        }
+    }
+
+    while (metrics_.cached_bytes > cache_bytes_ && !lru_.empty()) {
+        const auto it = pages_.find(lru_.back());
+        metrics_.cached_bytes -= it->second.page->size();
+        pages_.erase(it);
+        lru_.pop_back();
+        ++metrics_.evictions;
+    }
+
+    return requested;
+}
+
+void ColdPostingStore::ReadAt(uint64_t offset, char* buffer, size_t size) const {
+#if defined(_WIN32)
+    std::lock_guard guard(file_lock_);
+    file_.seekg(static_cast<std::streamoff>(offset));
+    if (!file_.read(buffer, static_cast<std::streamsize>(size))) throw std::runtime_error("Ошибка чтения файла "s + path_);
+#else
+    while (size > 0) {
+        const ssize_t count = pread(fd_, buffer, size, static_cast<off_t>(offset));
+        if (count <= 0) throw std::runtime_error("Ошибка чтения файла "s + path_);
+        buffer += count;
+        offset += static_cast<uint64_t>(count);
+        size -= static_cast<size_t>(count);
+    }
+#endif
+}
+
+void ColdPostingStore::WriteAt(uint64_t offset, const char* buffer, size_t size) {
+#if defined(_WIN32)
+    std::lock_guard guard(file_lock_);
+    file_.seekp(static_cast<std::streamoff>(offset));
+    if (!file_.write(buffer, static_cast<std::streamsize>(size))) throw std::runtime_error("Ошибка записи файла "s + path_);
+#else
+    while (size > 0) {
+        const ssize_t count = pwrite(fd_, buffer, size, static_cast<off_t>(offset));
+        if (count <= 0) throw std::runtime_error("Ошибка записи файла "s + path_);
+        buffer += count;
+        offset += static_cast<uint64_t>(count);
+        size -= static_cast<size_t>(count);
+    }
+#endif
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "document.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fstream>
+#endif
+
+struct ColdStorageSettings {
+    std::string path;
+    // Списки не короче этого порога выносятся на диск
+    size_t min_posting_count = 4096;
+    size_t cache_bytes = 64 << 20;
+    size_t page_size = 64 << 10;
+    // Сколько страниц списка читается одним запросом при промахе
+    size_t prefetch_pages = 8;
+    // Горячие термы остаются в памяти независимо от длины списка
+    std::set<std::string, std::less<>> resident_terms;
+};
+
+struct ColdCacheMetrics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t prefetched_pages = 0;
+    size_t bytes_read = 0;
+    size_t cached_bytes = 0;
+    size_t file_bytes = 0;
+    size_t live_bytes = 0;
+
+    double GetHitRate() const;
+};
+
+std::ostream& operator<<(std::ostream& out, const ColdCacheMetrics& metrics);
+
+struct ColdPosting {
+    int32_t document_id;
+    uint32_t term_count;
+};
+
+// Место списка в файле: разделы по статусам лежат подряд, внутри раздела id по возрастанию
+struct ColdPostingRef {
+    uint64_t offset = 0;
+    std::array<uint32_t, DOCUMENT_STATUS_COUNT> counts{};
+
+    inline uint64_t GetPartitionOffset(size_t status) const noexcept {
+        uint64_t partition_offset = offset;
+        for (size_t i = 0; i < status; ++i) {
+            partition_offset += counts[i] * sizeof(ColdPosting);
+        }
+        return partition_offset;
+    }
+
+    inline size_t GetDocumentCount() const noexcept {
+        size_t count = 0;
+        for (const uint32_t partition_count : counts) {
+            count += partition_count;
+        }
+        return count;
+    }
+};
+
+// Файл списков только дописывается; страницы читаются через ограниченный LRU-кэш.
+// Страница остается доступной читателю, пока он ее держит, даже после вытеснения.
+class ColdPostingStore {
+public:
+    explicit ColdPostingStore(const ColdStorageSettings& settings);
+
+    ColdPostingStore(const ColdPostingStore&) = delete;
+    ColdPostingStore& operator=(const ColdPostingStore&) = delete;
+
+    ~ColdPostingStore();
+
+    ColdPostingRef Append(const std::array<std::vector<ColdPosting>, DOCUMENT_STATUS_COUNT>& partitions);
+
+    // Отмечает список как мусор; место в файле освобождается только перезаписью хранилища
+    void Release(const ColdPostingRef& ref);
+
+    template <typename Function>
+    void ForEach(uint64_t offset, size_t count, Function function) const;
+
+    std::optional<uint32_t> Find(uint64_t offset, size_t count, int document_id) const;
+
+    ColdCacheMetrics GetMetrics() const;
+
+private:
+    using Page = std::vector<char>;
+
+    struct CacheEntry {
+        std::shared_ptr<const Page> page;
+        std::list<size_t>::iterator lru_position;
+    };
+
+    std::string path_;
+    size_t cache_bytes_;
+    size_t page_size_;
+    size_t prefetch_pages_;
+    uint64_t file_bytes_ = 0;
+
+#if defined(_WIN32)
+    mutable std::fstream file_;
+    mutable std::mutex file_lock_;
+#else
+    int fd_ = -1;
+#endif
+
+    mutable std::mutex cache_lock_;
+    mutable std::unordered_map<size_t, CacheEntry> pages_;
+    mutable std::list<size_t> lru_;
+    mutable ColdCacheMetrics metrics_;
+
+    std::shared_ptr<const Page> GetPage(size_t page_index, uint64_t read_limit) const;
+
+    ColdPosting ReadPosting(uint64_t position) const;
+
+    void ReadAt(uint64_t offset, char* buffer, size_t size) const;
+
+    void WriteAt(uint64_t offset, const char* buffer, size_t size);
+};
+
+template <typename Function>
+void ColdPostingStore::ForEach(uint64_t offset, size_t count, Function function) const {
+    uint64_t position = offset;
+    const uint64_t end = offset + count * sizeof(ColdPosting);
+
+    while (position < end) {
+        const size_t page_index = static_cast<size_t>(position / page_size_);
+        const std::shared_ptr<const Page> page = GetPage(page_index, end);
+        const uint64_t page_start = static_cast<uint64_t>(page_index) * page_size_;
+        const uint64_t page_end = std::min<uint64_t>(end, page_start + page->size());
+
+        for (; position < page_end; position += sizeof(ColdPosting)) {
+            ColdPosting posting;
+            std::memcpy(&posting, page->data() + (position - page_start), sizeof(ColdPosting));
+            function(static_cast<int>(posting.document_id), posting.term_count);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include "dense_accumulator.h"
+
+namespace {
+
+    struct ThreadAccumulator {
+        DenseAccumulator accumulator;
+        bool in_use = false;
+    };
+
+    ThreadAccumulator& GetThreadAccumulator() {
+        thread_local ThreadAccumulator accumulator;
+        return accumulator;
+    }
+}
+
+void DenseAccumulator::Resize(size_t slot_count) {
+    if (scores_.size() < slot_count) {
+        scores_.resize(slot_count, 0.0);
+        state_.resize(slot_count, SlotState::EMPTY);
+    }
+}
+
+size_t DenseAccumulator::GetScoredCount() const {
+    size_t count = 0;
+    for (const uint32_t slot : touched_) {
+        if (state_[slot] == SlotState::SCORED || state_[slot] == SlotState::EXCLUDED_SCORED) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void DenseAccumulator::Reset() {
+    for (const uint32_t slot : touched_) {
+        scores_[slot] = 0.0;
+        state_[slot] = SlotState::EMPTY;
+    }
+    touched_.clear();
+}
+
+DenseAccumulatorScope::DenseAccumulatorScope(size_t slot_count) {
+    ThreadAccumulator& thread_accumulator = GetThreadAccumulator();
+
+    if (thread_accumulator.in_use) {
+        accumulator_ = &nested_.emplace();
+    }
+    else {
+        thread_accumulator.in_use = true;
+        accumulator_ = &thread_accumulator.accumulator;
+    }
+
+    accumulator_->Resize(slot_count);
+}
+
+DenseAccumulatorScope::~DenseAccumulatorScope() {
+    accumulator_->Reset();
+    if (nested_) return;
+
+    GetThreadAccumulator().in_use = false;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+class DenseAccumulator {
+public:
+    void Resize(size_t slot_count);
+
+    inline void Add(uint32_t slot, double value) {
+        if (state_[slot] == SlotState::EMPTY) {
+            state_[slot] = SlotState::SCORED;
+            touched_.push_back(slot);
+        }
+        else if (state_[slot] == SlotState::EXCLUDED) {
+            state_[slot] = SlotState::EXCLUDED_SCORED;
+        }
+        scores_[slot] += value;
+    }
+
+    inline void Exclude(uint32_t slot) {
+        switch (state_[slot]) {
+        case SlotState::EMPTY:
+            touched_.push_back(slot);
+            state_[slot] = SlotState::EXCLUDED;
+            break;
+        case SlotState::SCORED:
+            state_[slot] = SlotState::EXCLUDED_SCORED;
+            break;
+        default:
+            break;
+        }
+    }
+
+    inline size_t GetTouchedCount() const noexcept {
+        return touched_.size();
+    }
+
+    template <typename Function>
+    void ForEachScored(Function function) const {
+        for (const uint32_t slot : touched_) {
+            if (state_[slot] == SlotState::SCORED) {
+                function(slot, scores_[slot]);
+            }
+        }
+    }
+
+    // Число слотов, получивших оценку, включая исключенные позже
+    size_t GetScoredCount() const;
+
+    void Reset();
+
+private:
+    enum class SlotState : uint8_t {
+        EMPTY,
+        SCORED,
+        EXCLUDED,
+        EXCLUDED_SCORED,
+    };
+
+    std::vector<double> scores_;
+    std::vector<SlotState> state_;
+    std::vector<uint32_t> touched_;
+};
+
+class DenseAccumulatorScope {
+public:
+    explicit DenseAccumulatorScope(size_t slot_count);
+
+    DenseAccumulatorScope(const DenseAccumulatorScope&) = delete;
+    DenseAccumulatorScope& operator=(const DenseAccumulatorScope&) = delete;
+
+    ~DenseAccumulatorScope();
+
+    inline DenseAccumulator& Get() noexcept {
+        return *accumulator_;
+    }
+
+private:
+    std::optional<DenseAccumulator> nested_;
+    DenseAccumulator* accumulator_;
+};
@@ -9,6 +9,8 @@ enum class DocumentStatus {
     REMOVED,
 };
 
+const size_t DOCUMENT_STATUS_COUNT = 4;
+
 struct Document {
     int id = 0;
     double relevance = 0;
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "document.h"
+
+#include <bitset>
+#include <climits>
+#include <initializer_list>
+
+class DocumentFilter {
+public:
+    DocumentFilter() {
+        statuses_.set();
+    }
+
+    DocumentFilter(std::initializer_list<DocumentStatus> statuses) {
+        for (const DocumentStatus status : statuses) {
+            statuses_.set(static_cast<size_t>(status));
+        }
+    }
+
+    inline DocumentFilter& SetRatingRange(int min_rating, int max_rating) noexcept {
+        min_rating_ = min_rating;
+        max_rating_ = max_rating;
+        return *this;
+    }
+
+    inline DocumentFilter& SetIdRange(int min_id, int max_id) noexcept {
+        min_id_ = min_id;
+        max_id_ = max_id;
+        return *this;
+    }
+
+    inline bool HasStatus(DocumentStatus status) const noexcept {
+        return statuses_.test(static_cast<size_t>(status));
+    }
+
+    inline bool HasRatingRange() const noexcept {
+        return min_rating_ != INT_MIN || max_rating_ != INT_MAX;
+    }
+
+    inline bool IsRatingAccepted(int rating) const noexcept {
+        return rating >= min_rating_ && rating <= max_rating_;
+    }
+
+    inline int GetMinId() const noexcept {
+        return min_id_;
+    }
+
+    inline int GetMaxId() const noexcept {
+        return max_id_;
+    }
+
+private:
+    std::bitset<DOCUMENT_STATUS_COUNT> statuses_;
+    int min_rating_ = INT_MIN;
+    int max_rating_ = INT_MAX;
+    int min_id_ = 0;
+    int max_id_ = INT_MAX;
+};
@@ -0,0 +1,254 @@
+#include "document_loader.h"
+#include "bounded_queue.h"
+#include "string_processing.h"
+
+#include <atomic>
+#include <charconv>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#if defined(_WIN32)
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std::string_literals;
+
+namespace {
+
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string& path) {
+#if defined(_WIN32)
+            std::ifstream in(path, std::ios::binary);
+            if (!in) throw std::runtime_error("Не удалось открыть файл "s + path);
+            buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+#else
+            const int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("Не удалось открыть файл "s + path);
+
+            struct stat info {};
+            if (fstat(fd, &info) != 0) {
+                close(fd);
+                throw std::runtime_error("Не удалось получить размер файла "s + path);
+            }
+
+            size_ = static_cast<size_t>(info.st_size);
+            if (size_ > 0) {
+                void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped == MAP_FAILED) {
+                    close(fd);
+                    throw std::runtime_error("Не удалось отобразить файл в память "s + path);
+                }
+                madvise(mapped, size_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char*>(mapped);
+            }
+            close(fd);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile() {
+#if !defined(_WIN32)
+            if (size_ > 0) {
+                munmap(const_cast<char*>(data_), size_);
+            }
+#endif
+        }
+
+        inline std::string_view GetData() const noexcept {
+            return { data_, size_ };
+        }
+
+    private:
+        const char* data_ = nullptr;
+        size_t size_ = 0;
+#if defined(_WIN32)
+        std::string buffer_;
+#endif
+    };
+
+    // Номер куска в файле: индексатор применяет пакеты строго по порядку, поэтому
+    // при повторном id или ошибке разбора результат не зависит от того, какой токенизатор успел первым
+    struct Chunk {
+        size_t sequence;
+        std::string_view data;
+    };
+
+    struct ParsedBatch {
+        size_t sequence;
+        std::vector<DumpRecord> documents;
+        std::exception_ptr error;
+    };
+
+    std::string_view NextField(std::string_view& line) {
+        const size_t tab = line.find('\t');
+        if (tab == std::string_view::npos) throw std::invalid_argument("Некорректная строка дампа: "s + std::string(line));
+
+        const std::string_view field = line.substr(0, tab);
+        line.remove_prefix(tab + 1);
+        return field;
+    }
+
+    int ParseInt(std::string_view text) {
+        int value = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc() || end != text.data() + text.size()) throw std::invalid_argument("Некорректное число: "s + std::string(text));
+        return value;
+    }
+
+    // При ошибке в documents остаются строки куска до ошибочной
+    void ParseChunk(std::string_view chunk, std::vector<DumpRecord>& documents) {
+        while (!chunk.empty()) {
+            const size_t end = chunk.find('\n');
+            const std::string_view line = chunk.substr(0, end);
+            if (!line.empty() && line != "\r") {
+                documents.push_back(ParseDumpLine(line));
+            }
+            chunk.remove_prefix(end == std::string_view::npos ? chunk.size() : end + 1);
+        }
+    }
+}
+
+DumpRecord ParseDumpLine(std::string_view line) {
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+
+    DumpRecord document;
+    document.id = ParseInt(NextField(line));
+
+    const int status = ParseInt(NextField(line));
+    if (status < 0 || status >= static_cast<int>(DOCUMENT_STATUS_COUNT)) throw std::invalid_argument("Некорректный статус документа "s + std::to_string(document.id));
+    document.status = static_cast<DocumentStatus>(status);
+
+    std::string_view ratings = NextField(line);
+    while (!ratings.empty()) {
+        const size_t space = ratings.find(' ');
+        document.ratings.push_back(ParseInt(ratings.substr(0, space)));
+        ratings.remove_prefix(space == std::string_view::npos ? ratings.size() : space + 1);
+    }
+
+    document.words = SplitIntoWords(line);
+    return document;
+}
+
+double LoaderStats::GetDocumentsPerSecond() const {
+    const double seconds = duration.count() / 1000.0;
+    return seconds > 0 ? documents / seconds : 0.0;
+}
+
+double LoaderStats::GetMegabytesPerSecond() const {
+    const double seconds = duration.count() / 1000.0;
+    return seconds > 0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0;
+}
+
+LoaderStats LoadDocuments(SearchServer& search_server, const std::string& path, const LoaderSettings& settings) {
+    using Clock = std::chrono::steady_clock;
+
+    if (settings.tokenizer_count == 0 || settings.chunk_size == 0 || settings.queue_capacity == 0) throw std::invalid_argument("Некорректные настройки загрузчика"s);
+
+    const auto start = Clock::now();
+    const MappedFile file(path);
+    const std::string_view data = file.GetData();
+
+    BoundedQueue<Chunk> chunks(settings.queue_capacity);
+    BoundedQueue<ParsedBatch> batches(settings.queue_capacity);
+
+    std::mutex error_lock;
+    std::exception_ptr error;
+    auto fail = [&](std::exception_ptr current) {
+        {
+            std::lock_guard guard(error_lock);
+            if (!error) error = current;
+        }
+        chunks.Close();
+        batches.Close();
+    };
+
+    std::thread reader([&]() {
+        std::string_view rest = data;
+        for (size_t sequence = 0; !rest.empty(); ++sequence) {
+            size_t end = std::min(settings.chunk_size, rest.size());
+            const size_t newline = rest.find('\n', end - 1);
+            end = newline == std::string_view::npos ? rest.size() : newline + 1;
+
+            if (!chunks.Push({ sequence, rest.substr(0, end) })) return;
+            rest.remove_prefix(end);
+        }
+        chunks.Close();
+    });
+
+    std::atomic<size_t> running_tokenizers = settings.tokenizer_count;
+    std::vector<std::thread> tokenizers;
+    tokenizers.reserve(settings.tokenizer_count);
+    for (size_t i = 0; i < settings.tokenizer_count; ++i) {
+        tokenizers.emplace_back([&]() {
+            // Ошибка разбора едет в пакете и поднимается индексатором в порядке файла
+            while (auto chunk = chunks.Pop()) {
+                ParsedBatch batch{ chunk->sequence, {}, nullptr };
+                try {
+                    ParseChunk(chunk->data, batch.documents);
+                }
+                catch (...) {
+                    batch.error = std::current_exception();
+                }
+                if (!batches.Push(std::move(batch))) break;
+            }
+            if (--running_tokenizers == 0) {
+                batches.Close();
+            }
+        });
+    }
+
+    LoaderStats stats;
+    try {
+        std::map<size_t, ParsedBatch> pending;
+        size_t next_sequence = 0;
+        while (auto batch = batches.Pop()) {
+            pending.emplace(batch->sequence, std::move(*batch));
+            for (auto it = pending.begin(); it != pending.end() && it->first == next_sequence; it = pending.erase(it), ++next_sequence) {
+                for (DumpRecord& document : it->second.documents) {
+                    search_server.AddTokenizedDocument(document.id, std::move(document.words), document.status, document.ratings);
+                }
+                stats.documents += it->second.documents.size();
+                if (it->second.error) std::rethrow_exception(it->second.error);
+            }
+        }
+    }
+    catch (...) {
+        fail(std::current_exception());
+    }
+
+    reader.join();
+    for (auto& tokenizer : tokenizers) {
+        tokenizer.join();
+    }
+
+    if (error) std::rethrow_exception(error);
+
+    stats.bytes = data.size();
+    stats.duration = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+    return stats;
+}
+
+std::ostream& operator<<(std::ostream& out, const LoaderStats& stats) {
+    out << "documents: "s << stats.documents
+        << ", bytes: "s << stats.bytes
+        << ", time: "s << stats.duration.count() << " ms"s
+        << ", "s << std::fixed << std::setprecision(1) << stats.GetDocumentsPerSecond() << " docs/s"s
+        << ", "s << stats.GetMegabytesPerSecond() << " MB/s"s;
+    return out;
+}
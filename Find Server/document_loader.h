@@ -0,0 +1,41 @@
+#pragma once
+
+#include "search_server.h"
+#include "document.h"
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+struct LoaderSettings {
+    size_t tokenizer_count = std::max(1u, std::thread::hardware_concurrency());
+    size_t chunk_size = 1 << 20;
+    size_t queue_capacity = 16;
+};
+
+struct LoaderStats {
+    size_t documents = 0;
+    size_t bytes = 0;
+    std::chrono::milliseconds duration{ 0 };
+
+    double GetDocumentsPerSecond() const;
+
+    double GetMegabytesPerSecond() const;
+};
+
+struct DumpRecord {
+    int id;
+    DocumentStatus status;
+    std::vector<int> ratings;
+    std::vector<std::string> words;
+};
+
+// Формат дампа: одна строка на документ, поля разделены табуляцией:
+// id, статус (число DocumentStatus), рейтинги через пробел, текст документа.
+DumpRecord ParseDumpLine(std::string_view line);
+
+LoaderStats LoadDocuments(SearchServer& search_server, const std::string& path, const LoaderSettings& settings = {});
+
+std::ostream& operator<<(std::ostream& out, const LoaderStats& stats);
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "document.h"
+
+#include <type_traits>
+
+// Политики отбора документов, которые ядро ранжирования распознает на этапе компиляции.
+// Для них постинги обходятся отдельным циклом: партиции чужих статусов пропускаются целиком,
+// а данные документа читаются, только если политике нужен рейтинг (NEEDS_RATING).
+// Политику можно передать везде, где принимается key_mapper(id, status, rating).
+struct AnyDocument {
+    static constexpr bool NEEDS_RATING = false;
+
+    inline bool HasStatus(DocumentStatus) const noexcept {
+        return true;
+    }
+
+    inline bool IsRatingAccepted(int) const noexcept {
+        return true;
+    }
+
+    inline bool operator()(int, DocumentStatus, int) const noexcept {
+        return true;
+    }
+};
+
+struct StatusEquals {
+    static constexpr bool NEEDS_RATING = false;
+
+    DocumentStatus status = DocumentStatus::ACTUAL;
+
+    inline bool HasStatus(DocumentStatus document_status) const noexcept {
+        return document_status == status;
+    }
+
+    inline bool IsRatingAccepted(int) const noexcept {
+        return true;
+    }
+
+    inline bool operator()(int, DocumentStatus document_status, int) const noexcept {
+        return HasStatus(document_status);
+    }
+};
+
+// Документы любого статуса с рейтингом не ниже min_rating
+struct RatingAtLeast {
+    static constexpr bool NEEDS_RATING = true;
+
+    int min_rating = 0;
+
+    inline bool HasStatus(DocumentStatus) const noexcept {
+        return true;
+    }
+
+    inline bool IsRatingAccepted(int rating) const noexcept {
+        return rating >= min_rating;
+    }
+
+    inline bool operator()(int, DocumentStatus, int rating) const noexcept {
+        return IsRatingAccepted(rating);
+    }
+};
+
+template<typename KeyMapper, typename = void>
+struct IsDocumentPredicate : std::false_type {};
+
+template<typename KeyMapper>
+struct IsDocumentPredicate<KeyMapper, std::void_t<decltype(std::decay_t<KeyMapper>::NEEDS_RATING)>> : std::true_type {};
@@ -0,0 +1,145 @@
+#include "fuzzy_index.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <unordered_set>
+
+using namespace std::string_literals;
+
+FuzzyIndex::FuzzyIndex(const FuzzySettings& settings) : settings_(settings) {
+    if (settings_.max_distance < 1 || settings_.max_distance > 2) throw std::invalid_argument("Допустимое расстояние правки - 1 или 2"s);
+    if (settings_.prefix_length <= static_cast<size_t>(settings_.max_distance)) throw std::invalid_argument("Длина префикса должна быть больше расстояния правки"s);
+}
+
+void FuzzyIndex::AddWord(const std::string& word) {
+    if (word_to_index_.count(word)) return;
+
+    const size_t index = words_.size();
+    words_.push_back(word);
+    word_to_index_.emplace(word, index);
+
+    for (auto& level : GenerateDeletes(ToCodePoints(word))) {
+        for (auto& deleted : level) {
+            deletes_[std::move(deleted)].push_back(index);
+        }
+    }
+}
+
+std::vector<std::string> FuzzyIndex::FindClosest(const std::string_view word, const std::function<bool(const std::string&)>& is_live) const {
+    const std::u32string query = ToCodePoints(word);
+
+    std::unordered_set<size_t> checked;
+    std::vector<std::string> closest;
+    int best_distance = settings_.max_distance + 1;
+    size_t budget = settings_.max_candidates;
+
+    for (const auto& level : GenerateDeletes(query)) {
+        for (const auto& deleted : level) {
+            const auto it = deletes_.find(deleted);
+            if (it == deletes_.end()) continue;
+
+            for (const size_t index : it->second) {
+                if (!checked.insert(index).second || !is_live(words_[index])) continue;
+
+                const std::u32string candidate = ToCodePoints(words_[index]);
+                if (std::abs(static_cast<int>(candidate.size()) - static_cast<int>(query.size())) > settings_.max_distance) continue;
+                if (budget == 0) {
+                    std::sort(closest.begin(), closest.end());
+                    return closest;
+                }
+                --budget;
+
+                // Для слов дальше max_distance расстояние отсекается на max_distance + 1, их не возвращаем
+                const int distance = ComputeEditDistance(query, candidate, settings_.max_distance);
+                if (distance == 0 || distance > settings_.max_distance || distance > best_distance) continue;
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    closest.clear();
+                }
+                closest.push_back(words_[index]);
+            }
+        }
+    }
+
+    std::sort(closest.begin(), closest.end());
+    return closest;
+}
+
+std::u32string FuzzyIndex::ToCodePoints(const std::string_view word) {
+    std::u32string out;
+    out.reserve(word.size());
+
+    for (size_t i = 0; i < word.size();) {
+        const unsigned char c = word[i];
+        size_t length = 1;
+        char32_t code = c;
+
+        if (c >= 0xF0) {
+            length = 4;
+            code = c & 0x07;
+        }
+        else if (c >= 0xE0) {
+            length = 3;
+            code = c & 0x0F;
+        }
+        else if (c >= 0xC0) {
+            length = 2;
+            code = c & 0x1F;
+        }
+
+        for (size_t j = 1; j < length && i + j < word.size(); ++j) {
+            code = (code << 6) | (static_cast<unsigned char>(word[i + j]) & 0x3F);
+        }
+
+        out.push_back(code);
+        i += length;
+    }
+
+    return out;
+}
+
+int FuzzyIndex::ComputeEditDistance(const std::u32string& lhs, const std::u32string& rhs, int max_distance) {
+    std::vector<int> previous(rhs.size() + 1);
+    std::vector<int> current(rhs.size() + 1);
+
+    for (size_t j = 0; j <= rhs.size(); ++j) {
+        previous[j] = static_cast<int>(j);
+    }
+
+    for (size_t i = 1; i <= lhs.size(); ++i) {
+        current[0] = static_cast<int>(i);
+        int row_min = current[0];
+
+        for (size_t j = 1; j <= rhs.size(); ++j) {
+            const int substitution = previous[j - 1] + (lhs[i - 1] == rhs[j - 1] ? 0 : 1);
+            current[j] = std::min({ previous[j] + 1, current[j - 1] + 1, substitution });
+            row_min = std::min(row_min, current[j]);
+        }
+
+        if (row_min > max_distance) return max_distance + 1;
+        std::swap(previous, current);
+    }
+
+    return previous[rhs.size()];
+}
+
+std::vector<std::vector<std::u32string>> FuzzyIndex::GenerateDeletes(const std::u32string& word) const {
+    std::vector<std::vector<std::u32string>> levels = { { word.substr(0, settings_.prefix_length) } };
+    std::unordered_set<std::u32string> seen(levels[0].begin(), levels[0].end());
+
+    for (int distance = 0; distance < settings_.max_distance; ++distance) {
+        std::vector<std::u32string> next;
+        for (const auto& current : levels.back()) {
+            for (size_t i = 0; i < current.size(); ++i) {
+                std::u32string deleted = current.substr(0, i) + current.substr(i + 1);
+                if (seen.insert(deleted).second) {
+                    next.push_back(std::move(deleted));
+                }
+            }
+        }
+        levels.push_back(std::move(next));
+    }
+
+    return levels;
+}
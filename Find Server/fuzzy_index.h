@@ -0,0 +1,47 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct FuzzySettings {
+    int max_distance = 1;
+    size_t prefix_length = 7;
+    size_t max_candidates = 256;
+};
+
+class FuzzyIndex {
+public:
+    explicit FuzzyIndex(const FuzzySettings& settings = {});
+
+    void AddWord(const std::string& word);
+
+    // Ближайшие к word слова, для которых is_live истинно. Слова из индекса не удаляются,
+    // поэтому отвечать можно только живыми: иначе ближайшие мертвые слова скрыли бы живые чуть дальше.
+    // Варианты удаления проверяются по возрастанию числа удаленных символов, так что
+    // бюджет max_candidates отсекает дальних кандидатов, а не случайных.
+    std::vector<std::string> FindClosest(const std::string_view word, const std::function<bool(const std::string&)>& is_live) const;
+
+    inline const FuzzySettings& GetSettings() const noexcept {
+        return settings_;
+    }
+
+    inline size_t GetDeletesCount() const noexcept {
+        return deletes_.size();
+    }
+
+private:
+    FuzzySettings settings_;
+    std::vector<std::string> words_;
+    std::unordered_map<std::u32string, std::vector<size_t>> deletes_;
+    std::unordered_map<std::string, size_t> word_to_index_;
+
+    static std::u32string ToCodePoints(const std::string_view word);
+
+    static int ComputeEditDistance(const std::u32string& lhs, const std::u32string& rhs, int max_distance);
+
+    // Варианты префикса слова по уровням: на уровне k удалено k символов
+    std::vector<std::vector<std::u32string>> GenerateDeletes(const std::u32string& word) const;
+};
@@ -0,0 +1,394 @@
+#include "index_builder.h"
+#include "index_snapshot.h"
+#include "document_loader.h"
+#include "search_server.h"
+#include "string_processing.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <queue>
+#include <set>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_literals;
+
+namespace {
+
+    namespace fs = std::filesystem;
+
+    const size_t TREE_NODE_OVERHEAD = 4 * sizeof(void*);
+
+    using TermPostings = std::vector<std::pair<int32_t, uint32_t>>;
+
+    class TempFiles {
+    public:
+        explicit TempFiles(fs::path directory, std::string prefix)
+            : directory_(std::move(directory))
+            , prefix_(std::move(prefix)) {
+        }
+
+        TempFiles(const TempFiles&) = delete;
+        TempFiles& operator=(const TempFiles&) = delete;
+
+        ~TempFiles() {
+            for (const fs::path& path : paths_) {
+                std::error_code error;
+                fs::remove(path, error);
+            }
+        }
+
+        fs::path Create() {
+            paths_.push_back(directory_ / (prefix_ + std::to_string(paths_.size())));
+            return paths_.back();
+        }
+
+        void Remove(const fs::path& path) {
+            std::error_code error;
+            fs::remove(path, error);
+        }
+
+    private:
+        fs::path directory_;
+        std::string prefix_;
+        std::vector<fs::path> paths_;
+    };
+
+    class BufferedOutput {
+    public:
+        BufferedOutput(const fs::path& path, size_t buffer_size)
+            : buffer_(buffer_size) {
+            out_.rdbuf()->pubsetbuf(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            out_.open(path, std::ios::binary | std::ios::trunc);
+            if (!out_) throw std::runtime_error("Не удалось открыть файл "s + path.string());
+        }
+
+        inline std::ofstream& Get() noexcept {
+            return out_;
+        }
+
+        void Close() {
+            out_.close();
+            if (!out_) throw std::runtime_error("Ошибка записи временного файла"s);
+        }
+
+    private:
+        std::vector<char> buffer_;
+        std::ofstream out_;
+    };
+
+    class RunReader {
+    public:
+        RunReader(const fs::path& path, size_t buffer_size)
+            : buffer_(buffer_size) {
+            in_.rdbuf()->pubsetbuf(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            in_.open(path, std::ios::binary);
+            if (!in_) throw std::runtime_error("Не удалось открыть файл "s + path.string());
+            NextTerm();
+        }
+
+        inline bool IsEnd() const noexcept {
+            return end_;
+        }
+
+        inline const std::string& GetTerm() const noexcept {
+            return term_;
+        }
+
+        inline int32_t GetDocumentId() const noexcept {
+            return document_id_;
+        }
+
+        inline uint32_t GetCount() const noexcept {
+            return count_;
+        }
+
+        void Advance() {
+            if (!index_snapshot::ReadPosting(in_, document_id_, count_)) {
+                NextTerm();
+            }
+        }
+
+    private:
+        std::vector<char> buffer_;
+        std::ifstream in_;
+        std::string term_;
+        int32_t document_id_ = 0;
+        uint32_t count_ = 0;
+        bool end_ = false;
+
+        void NextTerm() {
+            while (index_snapshot::ReadTerm(in_, term_)) {
+                if (index_snapshot::ReadPosting(in_, document_id_, count_)) return;
+            }
+            end_ = true;
+        }
+    };
+
+    // Пишет записи, сгруппированные по термам, в формате снимка
+    class TermWriter {
+    public:
+        explicit TermWriter(std::ostream& out)
+            : out_(out) {
+        }
+
+        void Add(const std::string& term, int32_t document_id, uint32_t count) {
+            if (!has_term_ || term != term_) {
+                Finish();
+                term_ = term;
+                has_term_ = true;
+                index_snapshot::WriteString(out_, term_);
+                ++term_count_;
+            }
+            index_snapshot::WriteValue<int32_t>(out_, document_id);
+            index_snapshot::WriteValue<uint32_t>(out_, count);
+            ++posting_count_;
+        }
+
+        void Finish() {
+            if (has_term_) {
+                index_snapshot::WriteValue<int32_t>(out_, index_snapshot::END_OF_POSTINGS);
+                has_term_ = false;
+            }
+        }
+
+        inline size_t GetTermCount() const noexcept {
+            return term_count_;
+        }
+
+        inline size_t GetPostingCount() const noexcept {
+            return posting_count_;
+        }
+
+    private:
+        std::ostream& out_;
+        std::string term_;
+        bool has_term_ = false;
+        size_t term_count_ = 0;
+        size_t posting_count_ = 0;
+    };
+
+    class RunBuffer {
+    public:
+        void Add(std::string_view term, int32_t document_id, uint32_t count) {
+            auto it = terms_.find(term);
+            if (it == terms_.end()) {
+                it = terms_.emplace(std::string(term), TermPostings{}).first;
+                bytes_ += TREE_NODE_OVERHEAD + sizeof(decltype(terms_)::value_type) + (term.size() >= sizeof(std::string) ? term.size() + 1 : 0);
+            }
+
+            TermPostings& postings = it->second;
+            const size_t capacity = postings.capacity();
+            postings.emplace_back(document_id, count);
+            bytes_ += (postings.capacity() - capacity) * sizeof(TermPostings::value_type);
+        }
+
+        inline size_t GetBytes() const noexcept {
+            return bytes_;
+        }
+
+        inline bool IsEmpty() const noexcept {
+            return terms_.empty();
+        }
+
+        void Flush(std::ostream& out) {
+            TermWriter writer(out);
+            for (auto& [term, postings] : terms_) {
+                std::sort(postings.begin(), postings.end());
+                for (const auto& [document_id, count] : postings) {
+                    writer.Add(term, document_id, count);
+                }
+            }
+            writer.Finish();
+
+            terms_.clear();
+            bytes_ = 0;
+        }
+
+    private:
+        std::map<std::string, TermPostings, std::less<>> terms_;
+        size_t bytes_ = 0;
+    };
+
+    void MergeRuns(const std::vector<fs::path>& runs, TermWriter& writer, size_t buffer_size) {
+        std::vector<std::unique_ptr<RunReader>> readers;
+        readers.reserve(runs.size());
+        for (const fs::path& run : runs) {
+            readers.push_back(std::make_unique<RunReader>(run, buffer_size));
+        }
+
+        auto greater = [&readers](size_t lhs, size_t rhs) {
+            const RunReader& left = *readers[lhs];
+            const RunReader& right = *readers[rhs];
+            const int order = left.GetTerm().compare(right.GetTerm());
+            return order != 0 ? order > 0 : left.GetDocumentId() > right.GetDocumentId();
+        };
+        std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> heap(greater);
+        for (size_t i = 0; i < readers.size(); ++i) {
+            if (!readers[i]->IsEnd()) {
+                heap.push(i);
+            }
+        }
+
+        while (!heap.empty()) {
+            const size_t i = heap.top();
+            heap.pop();
+
+            RunReader& reader = *readers[i];
+            writer.Add(reader.GetTerm(), reader.GetDocumentId(), reader.GetCount());
+            reader.Advance();
+            if (!reader.IsEnd()) {
+                heap.push(i);
+            }
+        }
+        writer.Finish();
+    }
+
+    bool IsValidWord(std::string_view word) {
+        return std::none_of(word.begin(), word.end(), [](char c) {
+            return c >= '\0' && c < ' ';
+            });
+    }
+}
+
+IndexBuildStats BuildIndexSnapshot(const std::string& dump_path, const std::string& snapshot_path,
+    const std::string& stop_words_text, const IndexBuilderSettings& settings) {
+    using Clock = std::chrono::steady_clock;
+
+    if (settings.io_buffer_size == 0 || settings.memory_limit < 2 * settings.io_buffer_size) throw std::invalid_argument("Некорректные настройки построителя индекса"s);
+
+    const auto start = Clock::now();
+    IndexBuildStats stats;
+
+    const fs::path temp_directory = settings.temp_directory.empty() ? fs::temp_directory_path() : fs::path(settings.temp_directory);
+    TempFiles temp_files(temp_directory, fs::path(snapshot_path).filename().string() + ".tmp"s);
+
+    if (!IsValidWord(stop_words_text)) throw std::invalid_argument("Недопустимые знаки"s);
+    const std::vector<std::string> stop_word_list = SplitIntoWords(stop_words_text);
+    const std::set<std::string, std::less<>> stop_words(stop_word_list.begin(), stop_word_list.end());
+
+    std::ifstream dump(dump_path, std::ios::binary);
+    if (!dump) throw std::runtime_error("Не удалось открыть файл "s + dump_path);
+
+    const fs::path documents_path = temp_files.Create();
+    BufferedOutput documents(documents_path, settings.io_buffer_size);
+
+    std::vector<fs::path> runs;
+    RunBuffer buffer;
+    auto flush_run = [&]() {
+        runs.push_back(temp_files.Create());
+        BufferedOutput run(runs.back(), settings.io_buffer_size);
+        buffer.Flush(run.Get());
+        run.Close();
+    };
+
+    // Буферы чтения и записи тоже занимают бюджет
+    const size_t buffer_limit = settings.memory_limit - 2 * settings.io_buffer_size;
+
+    std::map<std::string_view, uint32_t> term_counts;
+    std::vector<int32_t> document_ids;
+    for (std::string line; std::getline(dump, line);) {
+        if (line.empty() || line == "\r"s) continue;
+
+        DumpRecord record = ParseDumpLine(line);
+        if (record.id < 0) throw std::invalid_argument("Отрицательный id "s + std::to_string(record.id));
+        document_ids.push_back(record.id);
+
+        record.words.erase(std::remove_if(record.words.begin(), record.words.end(), [&stop_words](const std::string& word) {
+            return stop_words.count(word) > 0;
+            }), record.words.end());
+
+        term_counts.clear();
+        for (const std::string& word : record.words) {
+            if (!IsValidWord(word)) throw std::invalid_argument("Недопустимые знаки в документе "s + std::to_string(record.id));
+            ++term_counts[word];
+        }
+        for (const auto& [word, term_count] : term_counts) {
+            buffer.Add(word, record.id, term_count);
+        }
+
+        index_snapshot::WriteValue<int32_t>(documents.Get(), record.id);
+        index_snapshot::WriteValue<uint8_t>(documents.Get(), static_cast<uint8_t>(record.status));
+        index_snapshot::WriteValue<int32_t>(documents.Get(), SearchServer::ComputeAverageRating(record.ratings));
+        index_snapshot::WriteValue<uint32_t>(documents.Get(), static_cast<uint32_t>(record.words.size()));
+        ++stats.documents;
+
+        stats.peak_buffer_bytes = std::max(stats.peak_buffer_bytes, buffer.GetBytes());
+        if (buffer.GetBytes() >= buffer_limit) {
+            flush_run();
+        }
+    }
+    if (!buffer.IsEmpty()) {
+        flush_run();
+    }
+    documents.Close();
+
+    // Повтор id иначе обнаружился бы только при загрузке снимка
+    std::sort(document_ids.begin(), document_ids.end());
+    const auto duplicate = std::adjacent_find(document_ids.begin(), document_ids.end());
+    if (duplicate != document_ids.end()) throw std::invalid_argument("Документ с таким id уже есть"s + "("s + std::to_string(*duplicate) + ")");
+    document_ids = {};
+    stats.runs = runs.size();
+
+    // Каждому открытому прогону нужен свой буфер чтения, плюс один буфер на запись
+    const size_t fan_in = std::max<size_t>(2, settings.memory_limit / settings.io_buffer_size - 1);
+    while (runs.size() > fan_in) {
+        std::vector<fs::path> merged_runs;
+        for (size_t begin = 0; begin < runs.size(); begin += fan_in) {
+            const std::vector<fs::path> group(runs.begin() + begin, runs.begin() + std::min(runs.size(), begin + fan_in));
+
+            merged_runs.push_back(temp_files.Create());
+            BufferedOutput run(merged_runs.back(), settings.io_buffer_size);
+            TermWriter writer(run.Get());
+            MergeRuns(group, writer, settings.io_buffer_size);
+            run.Close();
+
+            for (const fs::path& path : group) {
+                temp_files.Remove(path);
+            }
+        }
+        runs = std::move(merged_runs);
+        ++stats.merge_passes;
+    }
+
+    BufferedOutput snapshot(snapshot_path, settings.io_buffer_size);
+    std::ofstream& out = snapshot.Get();
+    index_snapshot::WriteMagic(out);
+
+    index_snapshot::WriteValue<uint32_t>(out, static_cast<uint32_t>(stop_words.size()));
+    for (const std::string& word : stop_words) {
+        index_snapshot::WriteString(out, word);
+    }
+
+    index_snapshot::WriteValue<uint64_t>(out, stats.documents);
+    {
+        std::ifstream documents_in(documents_path, std::ios::binary);
+        if (stats.documents > 0 && !(out << documents_in.rdbuf())) throw std::runtime_error("Ошибка записи снимка "s + snapshot_path);
+    }
+    temp_files.Remove(documents_path);
+
+    TermWriter writer(out);
+    MergeRuns(runs, writer, settings.io_buffer_size);
+    ++stats.merge_passes;
+    snapshot.Close();
+
+    stats.terms = writer.GetTermCount();
+    stats.postings = writer.GetPostingCount();
+    stats.duration = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+    return stats;
+}
+
+std::ostream& operator<<(std::ostream& out, const IndexBuildStats& stats) {
+    out << "documents: "s << stats.documents
+        << ", terms: "s << stats.terms
+        << ", postings: "s << stats.postings
+        << ", runs: "s << stats.runs
+        << ", merge passes: "s << stats.merge_passes
+        << ", peak buffer: "s << stats.peak_buffer_bytes << " bytes"s
+        << ", time: "s << stats.duration.count() << " ms"s;
+    return out;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+struct IndexBuilderSettings {
+    // Бюджет памяти на буфер прогона и на буферы чтения при слиянии
+    size_t memory_limit = 256 << 20;
+    size_t io_buffer_size = 1 << 20;
+    // Пустой путь - системный каталог временных файлов
+    std::string temp_directory;
+};
+
+struct IndexBuildStats {
+    size_t documents = 0;
+    size_t terms = 0;
+    size_t postings = 0;
+    size_t runs = 0;
+    size_t merge_passes = 0;
+    size_t peak_buffer_bytes = 0;
+    std::chrono::milliseconds duration{ 0 };
+};
+
+// Строит снимок индекса из дампа в формате LoadDocuments, не держа индекс в памяти целиком:
+// отсортированные прогоны (терм, документ, число вхождений) сбрасываются во временные файлы и сливаются.
+// Снимок загружается через SearchServer::LoadSnapshot. Повтор id в дампе - ошибка построения;
+// для проверки id всех документов держатся в памяти (4 байта на документ) сверх memory_limit.
+IndexBuildStats BuildIndexSnapshot(const std::string& dump_path, const std::string& snapshot_path,
+    const std::string& stop_words_text, const IndexBuilderSettings& settings = {});
+
+std::ostream& operator<<(std::ostream& out, const IndexBuildStats& stats);
@@ -0,0 +1,32 @@
+#include "index_builder.h"
+
+#include <iostream>
+#include <string>
+
+using namespace std::string_literals;
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: index_builder <dump_path> <snapshot_path> [memory_mb] [stop words...]"s << std::endl;
+        return 1;
+    }
+
+    std::string stop_words;
+    for (int i = 4; i < argc; ++i) {
+        stop_words += (i > 4 ? " "s : ""s) + argv[i];
+    }
+
+    try {
+        IndexBuilderSettings settings;
+        if (argc > 3) {
+            settings.memory_limit = std::stoul(argv[3]) << 20;
+        }
+        std::cout << BuildIndexSnapshot(argv[1], argv[2], stop_words, settings) << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
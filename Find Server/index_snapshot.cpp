@@ -0,0 +1,48 @@
+#include "index_snapshot.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std::string_literals;
+
+namespace index_snapshot {
+
+    void WriteString(std::ostream& out, std::string_view text) {
+        WriteValue<uint32_t>(out, static_cast<uint32_t>(text.size()));
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    void WriteMagic(std::ostream& out) {
+        out.write(MAGIC, sizeof(MAGIC));
+    }
+
+    std::string ReadString(std::istream& in) {
+        std::string text(ReadValue<uint32_t>(in), '\0');
+        if (!in.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+            ThrowTruncated();
+        }
+        return text;
+    }
+
+    void ReadMagic(std::istream& in) {
+        char magic[sizeof(MAGIC)] = {};
+        if (!in.read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), MAGIC)) throw std::invalid_argument("Файл не является снимком индекса"s);
+    }
+
+    bool ReadTerm(std::istream& in, std::string& term) {
+        if (in.peek() == std::istream::traits_type::eof()) return false;
+        term = ReadString(in);
+        return true;
+    }
+
+    bool ReadPosting(std::istream& in, int32_t& document_id, uint32_t& term_count) {
+        document_id = ReadValue<int32_t>(in);
+        if (document_id == END_OF_POSTINGS) return false;
+        term_count = ReadValue<uint32_t>(in);
+        return true;
+    }
+
+    void ThrowTruncated() {
+        throw std::invalid_argument("Снимок индекса поврежден или обрезан"s);
+    }
+}
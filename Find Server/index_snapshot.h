@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Формат снимка индекса (числа в порядке байтов машины, строка - u32 длина и байты):
+// сигнатура MAGIC;
+// u32 число стоп-слов и сами стоп-слова;
+// u64 число документов и записи (i32 id, u8 статус, i32 средний рейтинг, u32 число слов);
+// до конца файла - термы по возрастанию: строка терма, записи (i32 id, u32 число вхождений)
+// по возрастанию id, завершенные записью id = END_OF_POSTINGS.
+// Временные файлы построителя индекса хранят термы в том же виде.
+namespace index_snapshot {
+
+    const char MAGIC[8] = { 'F', 'S', 'I', 'N', 'D', 'E', 'X', '2' };
+    const int32_t END_OF_POSTINGS = -1;
+
+    template <typename T>
+    void WriteValue(std::ostream& out, T value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void WriteString(std::ostream& out, std::string_view text);
+
+    void WriteMagic(std::ostream& out);
+
+    void ThrowTruncated();
+
+    template <typename T>
+    T ReadValue(std::istream& in) {
+        T value{};
+        if (!in.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+            ThrowTruncated();
+        }
+        return value;
+    }
+
+    std::string ReadString(std::istream& in);
+
+    void ReadMagic(std::istream& in);
+
+    // Следующий терм, если файл не закончился
+    bool ReadTerm(std::istream& in, std::string& term);
+
+    // Следующая запись терма; false - список терма закончился
+    bool ReadPosting(std::istream& in, int32_t& document_id, uint32_t& term_count);
+}
@@ -0,0 +1,36 @@
+#include "index_stats.h"
+
+using namespace std::string_literals;
+
+std::ostream& operator<<(std::ostream& out, const IndexStats& stats) {
+    out << "terms: "s << stats.term_count
+        << ", documents: "s << stats.document_count
+        << ", postings: "s << stats.posting_count
+        << ", tombstones: "s << stats.tombstone_count
+        << ", tombstoned postings: "s << stats.tombstoned_posting_count
+        << ", cold postings: "s << stats.cold_posting_count
+        << ", impact lists: "s << stats.impact_list_count
+        << ", avg terms per document: "s << stats.average_terms_per_document << '\n';
+
+    out << "bytes: dictionary "s << stats.term_dictionary_bytes
+        << ", postings "s << stats.postings_bytes
+        << ", forward index "s << stats.forward_index_bytes
+        << ", documents "s << stats.document_table_bytes
+        << ", stop words "s << stats.stop_words_bytes
+        << ", tombstones "s << stats.tombstone_bytes
+        << ", total "s << stats.GetTotalBytes()
+        << ", cold file "s << stats.cold_file_bytes
+        << ", shared dictionary "s << stats.shared_dictionary_bytes << '\n';
+
+    out << "posting lengths:"s;
+    for (const auto& [bound, count] : stats.posting_length_histogram) {
+        out << " <="s << bound << ": "s << count;
+    }
+    out << '\n';
+
+    out << "longest postings:"s;
+    for (const auto& [term, length] : stats.longest_postings) {
+        out << ' ' << term << " ("s << length << ')';
+    }
+    return out;
+}
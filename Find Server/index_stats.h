@@ -0,0 +1,42 @@
+#pragma once
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct IndexStats {
+    size_t term_count = 0;
+    size_t document_count = 0;
+    // Только постинги живых документов
+    size_t posting_count = 0;
+    size_t tombstone_count = 0;
+    // Постинги удаленных документов, ждущие уплотнения индекса
+    size_t tombstoned_posting_count = 0;
+    size_t cold_posting_count = 0;
+    size_t impact_list_count = 0;
+
+    size_t term_dictionary_bytes = 0;
+    size_t postings_bytes = 0;
+    size_t forward_index_bytes = 0;
+    size_t document_table_bytes = 0;
+    size_t stop_words_bytes = 0;
+    // Память удаленных документов до уплотнения: их постинги и наборы слов
+    size_t tombstone_bytes = 0;
+    // Не входит в GetTotalBytes: списки на диске, а не в памяти
+    size_t cold_file_bytes = 0;
+    // Не входит в GetTotalBytes: общий словарь делится между всеми подключенными серверами
+    size_t shared_dictionary_bytes = 0;
+
+    // Ключ - верхняя граница корзины (степень двойки), значение - число термов
+    std::map<size_t, size_t> posting_length_histogram;
+    std::vector<std::pair<std::string, size_t>> longest_postings;
+    double average_terms_per_document = 0.0;
+
+    inline size_t GetTotalBytes() const noexcept {
+        return term_dictionary_bytes + postings_bytes + forward_index_bytes + document_table_bytes + stop_words_bytes + tombstone_bytes;
+    }
+};
+
+std::ostream& operator<<(std::ostream& out, const IndexStats& stats);
@@ -0,0 +1,37 @@
+#include "latency_stats.h"
+
+#include <algorithm>
+
+using namespace std::string_literals;
+
+namespace {
+
+    std::chrono::microseconds Percentile(const std::vector<std::chrono::microseconds>& sorted, double fraction) {
+        const size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+}
+
+LatencySummary SummarizeLatencies(std::vector<std::chrono::microseconds> latencies) {
+    LatencySummary summary;
+    summary.count = latencies.size();
+    if (latencies.empty()) return summary;
+
+    std::sort(latencies.begin(), latencies.end());
+    summary.p50 = Percentile(latencies, 0.5);
+    summary.p90 = Percentile(latencies, 0.9);
+    summary.p99 = Percentile(latencies, 0.99);
+    summary.p999 = Percentile(latencies, 0.999);
+    summary.max = latencies.back();
+    return summary;
+}
+
+std::ostream& operator<<(std::ostream& out, const LatencySummary& summary) {
+    out << "requests: "s << summary.count
+        << ", p50: "s << summary.p50.count() << " us"s
+        << ", p90: "s << summary.p90.count() << " us"s
+        << ", p99: "s << summary.p99.count() << " us"s
+        << ", p999: "s << summary.p999.count() << " us"s
+        << ", max: "s << summary.max.count() << " us"s;
+    return out;
+}
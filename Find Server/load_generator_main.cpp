@@ -0,0 +1,106 @@
+#include "search_client.h"
+#include "latency_stats.h"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std::string_literals;
+
+int main(int argc, char* argv[]) {
+    using Clock = std::chrono::steady_clock;
+
+    if (argc < 3) {
+        std::cerr << "Usage: load_generator <socket_path> <queries_file> [threads] [requests_per_thread] [pipeline_depth]"s << std::endl;
+        return 1;
+    }
+
+    const std::string socket_path = argv[1];
+    const size_t thread_count = argc > 3 ? std::stoul(argv[3]) : 4;
+    const size_t requests_per_thread = argc > 4 ? std::stoul(argv[4]) : 10000;
+    const size_t pipeline_depth = std::max<size_t>(1, argc > 5 ? std::stoul(argv[5]) : 1);
+
+    std::vector<std::string> queries;
+    {
+        std::ifstream in(argv[2]);
+        for (std::string line; std::getline(in, line);) {
+            if (!line.empty()) {
+                queries.push_back(std::move(line));
+            }
+        }
+    }
+    if (queries.empty()) {
+        std::cerr << "Файл запросов пуст"s << std::endl;
+        return 1;
+    }
+
+    std::mutex latencies_lock;
+    std::vector<std::chrono::microseconds> latencies;
+    std::atomic<size_t> errors = 0;
+
+    const auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<std::chrono::microseconds> local;
+            local.reserve(requests_per_thread);
+
+            try {
+                SearchClient client(socket_path);
+                std::unordered_map<uint32_t, Clock::time_point> sent_at;
+                size_t sent = 0;
+
+                auto send_next = [&]() {
+                    search_protocol::Request request;
+                    request.request_id = static_cast<uint32_t>(sent);
+                    request.query = queries[(t * requests_per_thread + sent) % queries.size()];
+                    sent_at[request.request_id] = Clock::now();
+                    client.Send(request);
+                    ++sent;
+                };
+
+                while (sent < std::min(pipeline_depth, requests_per_thread)) {
+                    send_next();
+                }
+
+                for (size_t received = 0; received < requests_per_thread; ++received) {
+                    const search_protocol::Response response = client.Receive();
+                    const auto it = sent_at.find(response.request_id);
+                    local.push_back(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - it->second));
+                    sent_at.erase(it);
+
+                    if (response.code == search_protocol::ResponseCode::ERROR) {
+                        ++errors;
+                    }
+                    if (sent < requests_per_thread) {
+                        send_next();
+                    }
+                }
+            }
+            catch (const std::exception& e) {
+                std::cerr << e.what() << std::endl;
+                ++errors;
+            }
+
+            std::lock_guard guard(latencies_lock);
+            latencies.insert(latencies.end(), local.begin(), local.end());
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    const LatencySummary summary = SummarizeLatencies(latencies);
+
+    std::cout << summary << std::endl;
+    std::cout << "QPS: "s << (seconds > 0 ? summary.count / seconds : 0.0) << ", errors: "s << errors.load() << std::endl;
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "query_arena.h"
+
+#include <array>
+
+namespace {
+
+    struct ThreadArena {
+        alignas(std::max_align_t) std::array<std::byte, QUERY_ARENA_SIZE> buffer;
+        std::pmr::monotonic_buffer_resource resource{ buffer.data(), buffer.size() };
+        bool in_use = false;
+    };
+
+    ThreadArena& GetThreadArena() {
+        thread_local ThreadArena arena;
+        return arena;
+    }
+}
+
+QueryArena::QueryArena() {
+    ThreadArena& arena = GetThreadArena();
+
+    if (arena.in_use) {
+        resource_ = &nested_.emplace();
+        return;
+    }
+
+    arena.in_use = true;
+    resource_ = &arena.resource;
+}
+
+QueryArena::~QueryArena() {
+    if (nested_) return;
+
+    ThreadArena& arena = GetThreadArena();
+    arena.resource.release();
+    arena.in_use = false;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+
+const size_t QUERY_ARENA_SIZE = 64 * 1024;
+
+class QueryArena {
+public:
+    QueryArena();
+
+    QueryArena(const QueryArena&) = delete;
+    QueryArena& operator=(const QueryArena&) = delete;
+
+    ~QueryArena();
+
+    inline std::pmr::memory_resource* Get() noexcept {
+        return resource_;
+    }
+
+private:
+    std::optional<std::pmr::monotonic_buffer_resource> nested_;
+    std::pmr::monotonic_buffer_resource* resource_;
+};
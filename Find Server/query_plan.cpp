@@ -0,0 +1,39 @@
+#include "query_plan.h"
+
+using namespace std::string_literals;
+
+std::ostream& operator<<(std::ostream& out, ExclusionStrategy strategy) {
+    switch (strategy) {
+    case ExclusionStrategy::PREFILTER:
+        return out << "prefilter"s;
+    case ExclusionStrategy::MERGE:
+        return out << "merge"s;
+    case ExclusionStrategy::PROBE:
+        return out << "probe"s;
+    }
+    return out;
+}
+
+std::ostream& operator<<(std::ostream& out, const QueryPlan& plan) {
+    out << "accumulator: "s << (plan.dense_accumulator ? "dense"s : "sparse"s)
+        << ", estimated candidates: "s << plan.estimated_candidates
+        << " of "s << plan.document_count << '\n';
+
+    out << "plus:"s;
+    for (const PlannedTerm& term : plan.plus_terms) {
+        out << ' ' << term.word << " ("s << term.posting_count << ')';
+    }
+    if (plan.plus_prefix_count > 0) {
+        out << " + "s << plan.plus_prefix_count << " prefix(es)"s;
+    }
+    out << '\n';
+
+    out << "minus:"s;
+    for (const PlannedTerm& term : plan.minus_terms) {
+        out << ' ' << term.word << " ("s << term.posting_count << ", "s << term.strategy << ')';
+    }
+    if (plan.minus_prefix_count > 0) {
+        out << " + "s << plan.minus_prefix_count << " prefix(es), merge"s;
+    }
+    return out;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Способ исключения документов по минус-слову:
+// PREFILTER - слоты документов помечаются исключенными до подсчета релевантности,
+// MERGE - список документов минус-слова обходится после подсчета,
+// PROBE - каждый найденный документ проверяется по своему набору слов.
+enum class ExclusionStrategy {
+    PREFILTER,
+    MERGE,
+    PROBE,
+};
+
+struct PlannedTerm {
+    std::string word;
+    size_t posting_count = 0;
+    ExclusionStrategy strategy = ExclusionStrategy::MERGE;
+};
+
+struct QueryPlan {
+    std::vector<PlannedTerm> plus_terms;
+    std::vector<PlannedTerm> minus_terms;
+    size_t plus_prefix_count = 0;
+    size_t minus_prefix_count = 0;
+    size_t estimated_candidates = 0;
+    size_t document_count = 0;
+    bool dense_accumulator = false;
+};
+
+std::ostream& operator<<(std::ostream& out, ExclusionStrategy strategy);
+
+std::ostream& operator<<(std::ostream& out, const QueryPlan& plan);
@@ -0,0 +1,159 @@
+#include "query_replay.h"
+#include "request_queue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+using namespace std::string_literals;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    std::string_view NextField(std::string_view& line) {
+        const size_t tab = line.find('\t');
+        if (tab == std::string_view::npos) throw std::invalid_argument("Некорректная строка журнала: "s + std::string(line));
+
+        const std::string_view field = line.substr(0, tab);
+        line.remove_prefix(tab + 1);
+        return field;
+    }
+
+    long long ParseNumber(std::string_view text) {
+        long long value = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc() || end != text.data() + text.size()) throw std::invalid_argument("Некорректное число: "s + std::string(text));
+        return value;
+    }
+
+    QueryLogEntry ParseEntry(std::string_view line) {
+        QueryLogEntry entry;
+        entry.timestamp = std::chrono::milliseconds(ParseNumber(NextField(line)));
+
+        const long long status = ParseNumber(NextField(line));
+        if (status < 0 || status >= static_cast<long long>(DOCUMENT_STATUS_COUNT)) throw std::invalid_argument("Некорректный статус в журнале: "s + std::to_string(status));
+        entry.status = static_cast<DocumentStatus>(status);
+
+        entry.raw_query = std::string(line);
+        return entry;
+    }
+
+    // Смещение момента отправки запроса от начала воспроизведения.
+    std::optional<Clock::duration> GetScheduledOffset(const std::vector<QueryLogEntry>& log, size_t index, const ReplaySettings& settings) {
+        switch (settings.mode) {
+        case ReplayMode::ORIGINAL_PACE:
+            return std::chrono::duration_cast<Clock::duration>((log[index].timestamp - log.front().timestamp) / settings.speedup);
+        case ReplayMode::FIXED_RATE:
+            return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(index / settings.queries_per_second));
+        default:
+            return std::nullopt;
+        }
+    }
+}
+
+std::vector<QueryLogEntry> ReadQueryLog(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Не удалось открыть файл "s + path);
+
+    std::vector<QueryLogEntry> log;
+    for (std::string line; std::getline(in, line);) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty()) {
+            log.push_back(ParseEntry(line));
+        }
+    }
+
+    std::stable_sort(log.begin(), log.end(), [](const QueryLogEntry& lhs, const QueryLogEntry& rhs) {
+        return lhs.timestamp < rhs.timestamp;
+    });
+    return log;
+}
+
+double ReplayReport::GetQueriesPerSecond() const {
+    const double seconds = duration.count() / 1000.0;
+    return seconds > 0 ? latency.count / seconds : 0.0;
+}
+
+double ReplayReport::GetEmptyResultRatio() const {
+    return latency.count > 0 ? static_cast<double>(empty_results) / latency.count : 0.0;
+}
+
+ReplayReport ReplayQueryLog(const SearchServer& search_server, const std::vector<QueryLogEntry>& log, const ReplaySettings& settings) {
+    if (settings.thread_count == 0) throw std::invalid_argument("Некорректное число потоков воспроизведения"s);
+    if (settings.mode == ReplayMode::FIXED_RATE && settings.queries_per_second <= 0) throw std::invalid_argument("Некорректная частота запросов"s);
+    if (settings.mode == ReplayMode::ORIGINAL_PACE && settings.speedup <= 0) throw std::invalid_argument("Некорректный коэффициент ускорения"s);
+
+    ReplayReport report;
+    if (log.empty()) return report;
+
+    std::atomic<size_t> next_index = 0;
+    std::atomic<size_t> empty_results = 0;
+    std::atomic<size_t> errors = 0;
+    std::mutex latencies_lock;
+    std::vector<std::chrono::microseconds> latencies;
+    latencies.reserve(log.size());
+
+    const auto start = Clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(settings.thread_count);
+    for (size_t t = 0; t < settings.thread_count; ++t) {
+        threads.emplace_back([&]() {
+            // RequestQueue не потокобезопасна, поэтому у каждого клиента своя очередь.
+            RequestQueue request_queue(search_server);
+            std::vector<std::chrono::microseconds> local;
+
+            for (size_t index = next_index++; index < log.size(); index = next_index++) {
+                const QueryLogEntry& entry = log[index];
+
+                auto sent_at = Clock::now();
+                if (const auto offset = GetScheduledOffset(log, index, settings)) {
+                    sent_at = start + *offset;
+                    std::this_thread::sleep_until(sent_at);
+                }
+
+                try {
+                    const std::vector<Document> documents = settings.use_request_queue
+                        ? request_queue.AddFindRequest(entry.raw_query, entry.status)
+                        : search_server.FindTopDocuments(entry.raw_query, entry.status);
+                    if (documents.empty()) {
+                        ++empty_results;
+                    }
+                }
+                catch (const std::exception&) {
+                    ++errors;
+                }
+                local.push_back(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - sent_at));
+            }
+
+            std::lock_guard guard(latencies_lock);
+            latencies.insert(latencies.end(), local.begin(), local.end());
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    report.duration = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+    report.latency = SummarizeLatencies(std::move(latencies));
+    report.empty_results = empty_results;
+    report.errors = errors;
+    return report;
+}
+
+std::ostream& operator<<(std::ostream& out, const ReplayReport& report) {
+    out << report.latency << std::endl;
+    out << "QPS: "s << report.GetQueriesPerSecond()
+        << ", empty results: "s << report.GetEmptyResultRatio() * 100 << "%"s
+        << ", errors: "s << report.errors
+        << ", time: "s << report.duration.count() << " ms"s;
+    return out;
+}
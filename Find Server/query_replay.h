@@ -0,0 +1,51 @@
+#pragma once
+
+#include "search_server.h"
+#include "document.h"
+#include "latency_stats.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct QueryLogEntry {
+    std::chrono::milliseconds timestamp{ 0 };
+    DocumentStatus status = DocumentStatus::ACTUAL;
+    std::string raw_query;
+};
+
+// Формат журнала: одна строка на запрос, поля разделены табуляцией:
+// метка времени в миллисекундах, статус (число DocumentStatus), текст запроса.
+std::vector<QueryLogEntry> ReadQueryLog(const std::string& path);
+
+enum class ReplayMode {
+    ORIGINAL_PACE,
+    FIXED_RATE,
+    AS_FAST_AS_POSSIBLE,
+};
+
+struct ReplaySettings {
+    ReplayMode mode = ReplayMode::AS_FAST_AS_POSSIBLE;
+    size_t thread_count = 1;
+    double queries_per_second = 1000;
+    double speedup = 1.0;
+    bool use_request_queue = false;
+};
+
+struct ReplayReport {
+    LatencySummary latency;
+    size_t empty_results = 0;
+    size_t errors = 0;
+    std::chrono::milliseconds duration{ 0 };
+
+    double GetQueriesPerSecond() const;
+
+    double GetEmptyResultRatio() const;
+};
+
+// В режимах с заданным темпом задержка отсчитывается от запланированного момента
+// отправки, а не от фактического, чтобы отставание клиентов не скрывало очередь.
+ReplayReport ReplayQueryLog(const SearchServer& search_server, const std::vector<QueryLogEntry>& log, const ReplaySettings& settings = {});
+
+std::ostream& operator<<(std::ostream& out, const ReplayReport& report);
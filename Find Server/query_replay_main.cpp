@@ -0,0 +1,47 @@
+#include "query_replay.h"
+#include "document_loader.h"
+
+#include <iostream>
+#include <string>
+
+using namespace std::string_literals;
+
+namespace {
+
+    ReplayMode ParseMode(const std::string& mode) {
+        if (mode == "original"s) return ReplayMode::ORIGINAL_PACE;
+        if (mode == "fixed"s) return ReplayMode::FIXED_RATE;
+        if (mode == "fast"s) return ReplayMode::AS_FAST_AS_POSSIBLE;
+        throw std::invalid_argument("Неизвестный режим воспроизведения: "s + mode);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: query_replay <dump_path> <query_log> [original|fixed|fast] [threads] [qps|speedup] [queue]"s << std::endl;
+        return 1;
+    }
+
+    try {
+        SearchServer search_server(""s);
+        std::cerr << LoadDocuments(search_server, argv[1]) << std::endl;
+
+        const std::vector<QueryLogEntry> log = ReadQueryLog(argv[2]);
+
+        ReplaySettings settings;
+        settings.mode = argc > 3 ? ParseMode(argv[3]) : ReplayMode::AS_FAST_AS_POSSIBLE;
+        settings.thread_count = argc > 4 ? std::stoul(argv[4]) : 1;
+        if (argc > 5) {
+            (settings.mode == ReplayMode::ORIGINAL_PACE ? settings.speedup : settings.queries_per_second) = std::stod(argv[5]);
+        }
+        settings.use_request_queue = argc > 6 && argv[6] == "queue"s;
+
+        std::cout << ReplayQueryLog(search_server, log, settings) << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include "query_trace.h"
+
+using namespace std::string_literals;
+
+namespace {
+
+    std::ostream& operator<<(std::ostream& out, TermRole role) {
+        switch (role) {
+        case TermRole::PLUS:
+            return out << '+';
+        case TermRole::MINUS:
+            return out << '-';
+        case TermRole::PLUS_PREFIX:
+            return out << "+*"s;
+        case TermRole::MINUS_PREFIX:
+            return out << "-*"s;
+        }
+        return out;
+    }
+
+    double ToMicroseconds(std::chrono::nanoseconds duration) {
+        return duration.count() / 1000.0;
+    }
+}
+
+void QueryTracer::FinishStage(QueryStage stage) noexcept {
+    const auto now = Clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - stage_start_);
+    stage_start_ = now;
+
+    switch (stage) {
+    case QueryStage::PARSE:
+        trace_.parse_time += elapsed;
+        break;
+    case QueryStage::PLAN:
+        trace_.plan_time += elapsed;
+        break;
+    case QueryStage::SCORE:
+        trace_.score_time += elapsed;
+        break;
+    case QueryStage::SORT:
+        trace_.sort_time += elapsed;
+        break;
+    }
+}
+
+size_t QueryTracer::AddTerm(std::string_view word, TermRole role, size_t posting_count) {
+    trace_.terms.push_back({ std::string(word), role, posting_count, 0 });
+    return trace_.terms.size() - 1;
+}
+
+std::ostream& operator<<(std::ostream& out, const QueryTrace& trace) {
+    out << "parse: "s << ToMicroseconds(trace.parse_time) << " us"s
+        << ", plan: "s << ToMicroseconds(trace.plan_time) << " us"s
+        << ", score: "s << ToMicroseconds(trace.score_time) << " us"s
+        << ", sort: "s << ToMicroseconds(trace.sort_time) << " us"s << '\n';
+
+    out << "terms:"s;
+    for (const TermTrace& term : trace.terms) {
+        out << ' ' << term.role << term.word << " ("s << term.postings_visited << '/' << term.posting_count << ')';
+    }
+    if (trace.missing_terms > 0) {
+        out << ", missing: "s << trace.missing_terms;
+    }
+    out << '\n';
+
+    out << "scored: "s << trace.candidates_scored
+        << ", excluded: "s << trace.candidates_excluded
+        << ", results: "s << trace.results;
+    return out;
+}
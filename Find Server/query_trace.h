@@ -0,0 +1,108 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class QueryStage {
+    PARSE,
+    PLAN,
+    SCORE,
+    SORT,
+};
+
+enum class TermRole {
+    PLUS,
+    MINUS,
+    PLUS_PREFIX,
+    MINUS_PREFIX,
+};
+
+struct TermTrace {
+    std::string word;
+    TermRole role = TermRole::PLUS;
+    size_t posting_count = 0;
+    // Для минус-слов со стратегией PROBE - число проверенных кандидатов
+    size_t postings_visited = 0;
+};
+
+struct QueryTrace {
+    std::chrono::nanoseconds parse_time{ 0 };
+    std::chrono::nanoseconds plan_time{ 0 };
+    std::chrono::nanoseconds score_time{ 0 };
+    std::chrono::nanoseconds sort_time{ 0 };
+
+    std::vector<TermTrace> terms;
+    size_t missing_terms = 0;
+    size_t candidates_scored = 0;
+    size_t candidates_excluded = 0;
+    size_t results = 0;
+};
+
+std::ostream& operator<<(std::ostream& out, const QueryTrace& trace);
+
+// Политики сбора трассировки для шаблонов SearchServer. NullTracer не делает ничего,
+// и после встраивания его вызовы исчезают из кода поиска полностью.
+struct NullTracer {
+    static constexpr bool IS_ENABLED = false;
+
+    inline void StartStage() noexcept {}
+
+    inline void FinishStage(QueryStage) noexcept {}
+
+    inline size_t AddTerm(std::string_view, TermRole, size_t) noexcept {
+        return 0;
+    }
+
+    inline void AddVisited(size_t, size_t = 1) noexcept {}
+
+    inline void AddMissingTerm() noexcept {}
+
+    inline void SetScoredCount(size_t) noexcept {}
+
+    inline void SetResultCount(size_t) noexcept {}
+};
+
+class QueryTracer {
+public:
+    static constexpr bool IS_ENABLED = true;
+
+    explicit QueryTracer(QueryTrace& trace)
+        : trace_(trace) {
+        trace_ = {};
+    }
+
+    inline void StartStage() noexcept {
+        stage_start_ = Clock::now();
+    }
+
+    // Засчитывает время с предыдущей отметки указанной стадии и начинает следующую
+    void FinishStage(QueryStage stage) noexcept;
+
+    size_t AddTerm(std::string_view word, TermRole role, size_t posting_count);
+
+    inline void AddVisited(size_t term, size_t count = 1) noexcept {
+        trace_.terms[term].postings_visited += count;
+    }
+
+    inline void AddMissingTerm() noexcept {
+        ++trace_.missing_terms;
+    }
+
+    inline void SetScoredCount(size_t count) noexcept {
+        trace_.candidates_scored = count;
+    }
+
+    inline void SetResultCount(size_t count) noexcept {
+        trace_.results = count;
+        trace_.candidates_excluded = trace_.candidates_scored > count ? trace_.candidates_scored - count : 0;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    QueryTrace& trace_;
+    Clock::time_point stage_start_ = Clock::now();
+};
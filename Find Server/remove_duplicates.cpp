@@ -7,7 +7,7 @@ void RemoveDuplicates(SearchServer& search_server) {
 
 	using namespace std;
 
-	set<set<string>> for_duplicates;
+	set<set<string_view, less<>>> for_duplicates;
 	vector<int> duplicates_documents_id;
 
 	for (auto begin = search_server.begin(); begin != search_server.end(); begin++) {
@@ -18,7 +18,7 @@ void RemoveDuplicates(SearchServer& search_server) {
 	}
 
 	for (const auto& id : duplicates_documents_id) {
-		search_server.RemoveDocument(id);
 		cout << "Found duplicate document id " << id << endl;
 	}
+	search_server.RemoveDocuments(duplicates_documents_id);
 }
\ No newline at end of file
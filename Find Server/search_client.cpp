@@ -0,0 +1,89 @@
+#include "search_client.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace std::string_literals;
+using namespace search_protocol;
+
+SearchClient::SearchClient(const std::string& socket_path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) throw std::invalid_argument("Слишком длинный путь к сокету"s);
+    std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+    fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd_ < 0) throw std::runtime_error("Не удалось создать сокет: "s + std::strerror(errno));
+
+    if (connect(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+        const std::string error = std::strerror(errno);
+        close(fd_);
+        throw std::runtime_error("Не удалось подключиться к "s + socket_path + ": "s + error);
+    }
+}
+
+SearchClient::~SearchClient() {
+    close(fd_);
+}
+
+std::vector<Document> SearchClient::FindTopDocuments(const std::string& raw_query, DocumentStatus status) {
+    Request request;
+    request.type = RequestType::FIND_TOP;
+    request.status = status;
+    request.query = raw_query;
+    return Call(std::move(request)).documents;
+}
+
+std::tuple<std::vector<std::string>, DocumentStatus> SearchClient::MatchDocument(const std::string& raw_query, int document_id) {
+    Request request;
+    request.type = RequestType::MATCH;
+    request.document_id = document_id;
+    request.query = raw_query;
+
+    Response response = Call(std::move(request));
+    return { std::move(response.matched_words), response.status };
+}
+
+void SearchClient::Send(const Request& request) {
+    std::string frame;
+    EncodeRequest(request, frame);
+
+    size_t offset = 0;
+    while (offset < frame.size()) {
+        const ssize_t size = send(fd_, frame.data() + offset, frame.size() - offset, MSG_NOSIGNAL);
+        if (size < 0 && errno == EINTR) continue;
+        if (size <= 0) throw std::runtime_error("Ошибка отправки запроса: "s + std::strerror(errno));
+        offset += static_cast<size_t>(size);
+    }
+}
+
+Response SearchClient::Receive() {
+    while (true) {
+        std::string_view rest = input_;
+        if (const auto frame = ExtractFrame(rest)) {
+            Response response = DecodeResponse(*frame);
+            input_.erase(0, input_.size() - rest.size());
+            return response;
+        }
+
+        char buffer[16 * 1024];
+        const ssize_t size = recv(fd_, buffer, sizeof(buffer), 0);
+        if (size < 0 && errno == EINTR) continue;
+        if (size <= 0) throw std::runtime_error("Соединение с демоном прервано"s);
+        input_.append(buffer, static_cast<size_t>(size));
+    }
+}
+
+Response SearchClient::Call(Request request) {
+    request.request_id = next_request_id_++;
+    Send(request);
+
+    Response response = Receive();
+    if (response.code == ResponseCode::ERROR) throw std::invalid_argument(response.error);
+    return response;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "search_protocol.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+class SearchClient {
+public:
+    explicit SearchClient(const std::string& socket_path);
+
+    SearchClient(const SearchClient&) = delete;
+    SearchClient& operator=(const SearchClient&) = delete;
+
+    ~SearchClient();
+
+    std::vector<Document> FindTopDocuments(const std::string& raw_query, DocumentStatus status = DocumentStatus::ACTUAL);
+
+    std::tuple<std::vector<std::string>, DocumentStatus> MatchDocument(const std::string& raw_query, int document_id);
+
+    void Send(const search_protocol::Request& request);
+
+    search_protocol::Response Receive();
+
+private:
+    int fd_ = -1;
+    uint32_t next_request_id_ = 0;
+    std::string input_;
+
+    search_protocol::Response Call(search_protocol::Request request);
+};
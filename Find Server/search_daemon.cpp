@@ -0,0 +1,347 @@
+#include "search_daemon.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace std::string_literals;
+using namespace search_protocol;
+
+namespace {
+
+    const uint64_t LISTEN_TOKEN = 0;
+    const uint64_t WAKEUP_TOKEN = UINT64_MAX;
+    const char* const OVERLOADED_ERROR = "overloaded";
+
+    void SetNonBlocking(int fd) {
+        const int flags = fcntl(fd, F_GETFL, 0);
+        if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+            throw std::runtime_error("Не удалось перевести сокет в неблокирующий режим: "s + std::strerror(errno));
+        }
+    }
+
+    void AddToEpoll(int epoll_fd, int fd, uint32_t events, uint64_t token) {
+        epoll_event event{};
+        event.events = events;
+        event.data.u64 = token;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            throw std::runtime_error("Ошибка epoll_ctl: "s + std::strerror(errno));
+        }
+    }
+}
+
+SearchDaemon::SearchDaemon(const SearchServer& search_server, DaemonSettings settings)
+    : server_(search_server), settings_(std::move(settings)), batches_(settings_.queue_capacity) {
+
+    if (settings_.worker_count == 0 || settings_.max_batch_size == 0) throw std::invalid_argument("Некорректные настройки демона"s);
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (settings_.socket_path.size() >= sizeof(address.sun_path)) throw std::invalid_argument("Слишком длинный путь к сокету"s);
+    std::memcpy(address.sun_path, settings_.socket_path.c_str(), settings_.socket_path.size() + 1);
+
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd_ < 0) throw std::runtime_error("Не удалось создать сокет: "s + std::strerror(errno));
+
+    unlink(settings_.socket_path.c_str());
+    if (bind(listen_fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(listen_fd_, SOMAXCONN) < 0) {
+        const std::string error = std::strerror(errno);
+        close(listen_fd_);
+        throw std::runtime_error("Не удалось открыть сокет "s + settings_.socket_path + ": "s + error);
+    }
+    SetNonBlocking(listen_fd_);
+
+    epoll_fd_ = epoll_create1(0);
+    wakeup_fd_ = eventfd(0, EFD_NONBLOCK);
+    AddToEpoll(epoll_fd_, listen_fd_, EPOLLIN, LISTEN_TOKEN);
+    AddToEpoll(epoll_fd_, wakeup_fd_, EPOLLIN, WAKEUP_TOKEN);
+
+    workers_.reserve(settings_.worker_count);
+    for (size_t i = 0; i < settings_.worker_count; ++i) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+SearchDaemon::~SearchDaemon() {
+    Stop();
+    batches_.Close();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+
+    for (const auto& [_, connection] : connections_) {
+        close(connection.fd);
+    }
+    close(wakeup_fd_);
+    close(epoll_fd_);
+    close(listen_fd_);
+    unlink(settings_.socket_path.c_str());
+}
+
+void SearchDaemon::Stop() {
+    stopped_ = true;
+    const uint64_t one = 1;
+    [[maybe_unused]] const auto written = write(wakeup_fd_, &one, sizeof(one));
+}
+
+void SearchDaemon::Run() {
+    std::vector<epoll_event> events(settings_.max_events);
+
+    while (!stopped_) {
+        const int ready = epoll_wait(epoll_fd_, events.data(), static_cast<int>(events.size()), -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Ошибка epoll_wait: "s + std::strerror(errno));
+        }
+
+        Batch batch;
+        for (int i = 0; i < ready; ++i) {
+            const uint64_t token = events[i].data.u64;
+
+            if (token == LISTEN_TOKEN) {
+                AcceptConnections();
+            }
+            else if (token == WAKEUP_TOKEN) {
+                uint64_t counter = 0;
+                [[maybe_unused]] const auto read_bytes = read(wakeup_fd_, &counter, sizeof(counter));
+                DeliverCompleted();
+            }
+            else {
+                if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    ReadConnection(token, batch);
+                }
+                if ((events[i].events & EPOLLOUT) && connections_.count(token)) {
+                    WriteConnection(token);
+                }
+            }
+
+            if (batch.size() >= settings_.max_batch_size) {
+                DispatchBatch(batch);
+            }
+        }
+
+        DispatchBatch(batch);
+    }
+}
+
+void SearchDaemon::AcceptConnections() {
+    while (true) {
+        const int fd = accept(listen_fd_, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return;
+            throw std::runtime_error("Ошибка accept: "s + std::strerror(errno));
+        }
+
+        SetNonBlocking(fd);
+        const uint64_t connection_id = next_connection_id_++;
+        connections_.emplace(connection_id, Connection{ fd, {}, {} });
+        AddToEpoll(epoll_fd_, fd, EPOLLIN, connection_id);
+    }
+}
+
+void SearchDaemon::ReadConnection(uint64_t connection_id, Batch& batch) {
+    const auto it = connections_.find(connection_id);
+    if (it == connections_.end()) return;
+    Connection& connection = it->second;
+
+    // После EOF чтение из epoll снято, сюда приводят только EPOLLHUP и EPOLLERR: ответы отправить некуда
+    if (connection.read_closed) {
+        CloseConnection(connection_id);
+        return;
+    }
+
+    char buffer[16 * 1024];
+    while (true) {
+        const ssize_t size = read(connection.fd, buffer, sizeof(buffer));
+        if (size > 0) {
+            connection.input.append(buffer, static_cast<size_t>(size));
+            continue;
+        }
+        if (size == 0) {
+            connection.read_closed = true;
+            break;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        if (errno == EINTR) continue;
+
+        CloseConnection(connection_id);
+        return;
+    }
+
+    // Кадры, полученные до EOF, обрабатываются как обычно
+    std::string_view rest = connection.input;
+    try {
+        while (const auto frame = ExtractFrame(rest)) {
+            batch.push_back({ connection_id, DecodeRequest(*frame) });
+            ++connection.in_flight;
+        }
+    }
+    catch (const std::invalid_argument&) {
+        CloseConnection(connection_id);
+        return;
+    }
+    connection.input.erase(0, connection.input.size() - rest.size());
+
+    if (connection.read_closed) {
+        UpdateInterest(connection, connection_id);
+        CloseIfDrained(connection_id);
+    }
+}
+
+void SearchDaemon::WriteConnection(uint64_t connection_id) {
+    Connection& connection = connections_.at(connection_id);
+
+    size_t offset = 0;
+    while (offset < connection.output.size()) {
+        const ssize_t size = send(connection.fd, connection.output.data() + offset, connection.output.size() - offset, MSG_NOSIGNAL);
+        if (size > 0) {
+            offset += static_cast<size_t>(size);
+            continue;
+        }
+        if (size < 0 && errno == EINTR) continue;
+        if (size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+
+        CloseConnection(connection_id);
+        return;
+    }
+
+    connection.output.erase(0, offset);
+    UpdateInterest(connection, connection_id);
+    CloseIfDrained(connection_id);
+}
+
+void SearchDaemon::UpdateInterest(Connection& connection, uint64_t connection_id) {
+    // Сокет после EOF всегда готов к чтению, поэтому EPOLLIN с него снимается
+    const bool want_read = !connection.read_closed;
+    const bool want_write = !connection.output.empty();
+    if (want_read == connection.want_read && want_write == connection.want_write) return;
+
+    epoll_event event{};
+    event.events = (want_read ? EPOLLIN : 0u) | (want_write ? EPOLLOUT : 0u);
+    event.data.u64 = connection_id;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, connection.fd, &event);
+    connection.want_read = want_read;
+    connection.want_write = want_write;
+}
+
+void SearchDaemon::CloseConnection(uint64_t connection_id) {
+    const auto it = connections_.find(connection_id);
+    if (it == connections_.end()) return;
+
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, it->second.fd, nullptr);
+    close(it->second.fd);
+    connections_.erase(it);
+}
+
+void SearchDaemon::CloseIfDrained(uint64_t connection_id) {
+    const auto it = connections_.find(connection_id);
+    if (it == connections_.end()) return;
+
+    const Connection& connection = it->second;
+    if (connection.read_closed && connection.in_flight == 0 && connection.output.empty()) {
+        CloseConnection(connection_id);
+    }
+}
+
+void SearchDaemon::DispatchBatch(Batch& batch) {
+    if (batch.empty()) return;
+    // Блокирующая вставка остановила бы цикл epoll для всех клиентов, поэтому лишняя нагрузка отбрасывается
+    if (!batches_.TryPush(batch)) {
+        RejectBatch(batch);
+    }
+    batch = Batch();
+}
+
+void SearchDaemon::RejectBatch(Batch& batch) {
+    std::vector<uint64_t> touched;
+    for (const PendingRequest& pending : batch) {
+        const auto it = connections_.find(pending.connection_id);
+        if (it == connections_.end()) continue;
+
+        Response response;
+        response.type = pending.request.type;
+        response.request_id = pending.request.request_id;
+        response.code = ResponseCode::ERROR;
+        response.error = OVERLOADED_ERROR;
+        EncodeResponse(response, it->second.output);
+        --it->second.in_flight;
+        touched.push_back(pending.connection_id);
+    }
+
+    std::sort(touched.begin(), touched.end());
+    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+    for (const uint64_t connection_id : touched) {
+        if (connections_.count(connection_id)) {
+            WriteConnection(connection_id);
+        }
+    }
+}
+
+void SearchDaemon::DeliverCompleted() {
+    std::vector<Completed> completed;
+    {
+        std::lock_guard guard(completed_lock_);
+        completed.swap(completed_);
+    }
+
+    for (Completed& item : completed) {
+        const auto it = connections_.find(item.connection_id);
+        if (it == connections_.end()) continue;
+
+        it->second.output += item.frames;
+        it->second.in_flight -= item.response_count;
+        WriteConnection(item.connection_id);
+    }
+}
+
+void SearchDaemon::WorkerLoop() {
+    while (auto batch = batches_.Pop()) {
+        std::unordered_map<uint64_t, Completed> completed;
+        for (const PendingRequest& pending : *batch) {
+            Completed& item = completed.try_emplace(pending.connection_id, Completed{ pending.connection_id, {}, 0 }).first->second;
+            EncodeResponse(Execute(pending.request), item.frames);
+            ++item.response_count;
+        }
+
+        {
+            std::lock_guard guard(completed_lock_);
+            for (auto& [_, item] : completed) {
+                completed_.push_back(std::move(item));
+            }
+        }
+
+        const uint64_t one = 1;
+        [[maybe_unused]] const auto written = write(wakeup_fd_, &one, sizeof(one));
+    }
+}
+
+Response SearchDaemon::Execute(const Request& request) const {
+    Response response;
+    response.type = request.type;
+    response.request_id = request.request_id;
+
+    try {
+        if (request.type == RequestType::FIND_TOP) {
+            response.documents = server_.FindTopDocuments(request.query, request.status);
+        }
+        else {
+            const auto [words, status] = server_.MatchDocument(request.query, request.document_id);
+            response.matched_words.assign(words.begin(), words.end());
+            response.status = status;
+        }
+    }
+    catch (const std::exception& e) {
+        response.code = ResponseCode::ERROR;
+        response.error = e.what();
+    }
+
+    return response;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "search_server.h"
+#include "search_protocol.h"
+#include "bounded_queue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct DaemonSettings {
+    std::string socket_path;
+    size_t worker_count = std::max(1u, std::thread::hardware_concurrency());
+    size_t max_batch_size = 64;
+    size_t queue_capacity = 1024;
+    size_t max_events = 256;
+};
+
+class SearchDaemon {
+public:
+    SearchDaemon(const SearchServer& search_server, DaemonSettings settings);
+
+    SearchDaemon(const SearchDaemon&) = delete;
+    SearchDaemon& operator=(const SearchDaemon&) = delete;
+
+    ~SearchDaemon();
+
+    void Run();
+
+    void Stop();
+
+private:
+    struct Connection {
+        int fd;
+        std::string input;
+        std::string output;
+        bool want_read = true;
+        bool want_write = false;
+        // Клиент закрыл свою сторону: соединение закрывается, когда уйдут ответы на все его запросы
+        bool read_closed = false;
+        size_t in_flight = 0;
+    };
+
+    struct PendingRequest {
+        uint64_t connection_id;
+        search_protocol::Request request;
+    };
+
+    struct Completed {
+        uint64_t connection_id;
+        std::string frames;
+        size_t response_count;
+    };
+
+    using Batch = std::vector<PendingRequest>;
+
+    const SearchServer& server_;
+    const DaemonSettings settings_;
+
+    int listen_fd_ = -1;
+    int epoll_fd_ = -1;
+    int wakeup_fd_ = -1;
+    std::atomic<bool> stopped_ = false;
+
+    uint64_t next_connection_id_ = 1;
+    std::unordered_map<uint64_t, Connection> connections_;
+
+    BoundedQueue<Batch> batches_;
+    std::vector<std::thread> workers_;
+
+    std::mutex completed_lock_;
+    std::vector<Completed> completed_;
+
+    void AcceptConnections();
+
+    void ReadConnection(uint64_t connection_id, Batch& batch);
+
+    void WriteConnection(uint64_t connection_id);
+
+    void CloseConnection(uint64_t connection_id);
+
+    void CloseIfDrained(uint64_t connection_id);
+
+    void UpdateInterest(Connection& connection, uint64_t connection_id);
+
+    // Очередь не ждет: если она полна, запросы пакета сразу получают ответ ERROR
+    void DispatchBatch(Batch& batch);
+
+    void RejectBatch(Batch& batch);
+
+    void DeliverCompleted();
+
+    void WorkerLoop();
+
+    search_protocol::Response Execute(const search_protocol::Request& request) const;
+};
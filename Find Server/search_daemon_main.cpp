@@ -0,0 +1,53 @@
+#include "search_daemon.h"
+#include "document_loader.h"
+
+#include <csignal>
+#include <iostream>
+#include <string>
+
+using namespace std::string_literals;
+
+namespace {
+
+    SearchDaemon* running_daemon = nullptr;
+
+    void HandleStopSignal(int) {
+        if (running_daemon) {
+            running_daemon->Stop();
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: search_daemon <socket_path> <dump_path> [stop words...]"s << std::endl;
+        return 1;
+    }
+
+    std::string stop_words;
+    for (int i = 3; i < argc; ++i) {
+        stop_words += (i > 3 ? " "s : ""s) + argv[i];
+    }
+
+    try {
+        SearchServer search_server(stop_words);
+        std::cerr << LoadDocuments(search_server, argv[2]) << std::endl;
+
+        DaemonSettings settings;
+        settings.socket_path = argv[1];
+        SearchDaemon daemon(search_server, settings);
+
+        running_daemon = &daemon;
+        std::signal(SIGINT, HandleStopSignal);
+        std::signal(SIGTERM, HandleStopSignal);
+
+        daemon.Run();
+        running_daemon = nullptr;
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+#include "search_protocol.h"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace std::string_literals;
+
+namespace search_protocol {
+
+    namespace {
+
+        template <typename T>
+        void Write(std::string& out, T value) {
+            out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void WriteString(std::string& out, std::string_view text) {
+            Write<uint32_t>(out, static_cast<uint32_t>(text.size()));
+            out.append(text);
+        }
+
+        class Reader {
+        public:
+            explicit Reader(std::string_view data) : data_(data) {}
+
+            template <typename T>
+            T Read() {
+                if (data_.size() < sizeof(T)) throw std::invalid_argument("Неполный кадр протокола"s);
+                T value;
+                std::memcpy(&value, data_.data(), sizeof(T));
+                data_.remove_prefix(sizeof(T));
+                return value;
+            }
+
+            std::string ReadString() {
+                const uint32_t size = Read<uint32_t>();
+                if (data_.size() < size) throw std::invalid_argument("Неполный кадр протокола"s);
+                std::string value(data_.substr(0, size));
+                data_.remove_prefix(size);
+                return value;
+            }
+
+        private:
+            std::string_view data_;
+        };
+
+        size_t BeginFrame(std::string& out) {
+            const size_t header = out.size();
+            Write<uint32_t>(out, 0);
+            return header;
+        }
+
+        void EndFrame(std::string& out, size_t header) {
+            const uint32_t size = static_cast<uint32_t>(out.size() - header - FRAME_HEADER_SIZE);
+            std::memcpy(out.data() + header, &size, sizeof(size));
+        }
+
+        DocumentStatus ToStatus(uint8_t value) {
+            if (value >= DOCUMENT_STATUS_COUNT) throw std::invalid_argument("Некорректный статус документа"s);
+            return static_cast<DocumentStatus>(value);
+        }
+
+        RequestType ToRequestType(uint8_t value) {
+            if (value != static_cast<uint8_t>(RequestType::FIND_TOP) && value != static_cast<uint8_t>(RequestType::MATCH)) {
+                throw std::invalid_argument("Неизвестный тип запроса"s);
+            }
+            return static_cast<RequestType>(value);
+        }
+    }
+
+    void EncodeRequest(const Request& request, std::string& out) {
+        const size_t header = BeginFrame(out);
+        Write<uint8_t>(out, static_cast<uint8_t>(request.type));
+        Write<uint32_t>(out, request.request_id);
+        Write<uint8_t>(out, static_cast<uint8_t>(request.status));
+        Write<int32_t>(out, request.document_id);
+        WriteString(out, request.query);
+        EndFrame(out, header);
+    }
+
+    void EncodeResponse(const Response& response, std::string& out) {
+        const size_t header = BeginFrame(out);
+        Write<uint8_t>(out, static_cast<uint8_t>(response.type));
+        Write<uint32_t>(out, response.request_id);
+        Write<uint8_t>(out, static_cast<uint8_t>(response.code));
+
+        if (response.code == ResponseCode::ERROR) {
+            WriteString(out, response.error);
+        }
+        else if (response.type == RequestType::FIND_TOP) {
+            Write<uint32_t>(out, static_cast<uint32_t>(response.documents.size()));
+            for (const Document& document : response.documents) {
+                Write<int32_t>(out, document.id);
+                Write<double>(out, document.relevance);
+                Write<int32_t>(out, document.rating);
+            }
+        }
+        else {
+            Write<uint8_t>(out, static_cast<uint8_t>(response.status));
+            Write<uint32_t>(out, static_cast<uint32_t>(response.matched_words.size()));
+            for (const std::string& word : response.matched_words) {
+                WriteString(out, word);
+            }
+        }
+
+        EndFrame(out, header);
+    }
+
+    std::optional<std::string_view> ExtractFrame(std::string_view& buffer) {
+        if (buffer.size() < FRAME_HEADER_SIZE) return std::nullopt;
+
+        uint32_t size = 0;
+        std::memcpy(&size, buffer.data(), sizeof(size));
+        if (size > MAX_FRAME_SIZE) throw std::invalid_argument("Слишком большой кадр протокола"s);
+        if (buffer.size() < FRAME_HEADER_SIZE + size) return std::nullopt;
+
+        const std::string_view frame = buffer.substr(FRAME_HEADER_SIZE, size);
+        buffer.remove_prefix(FRAME_HEADER_SIZE + size);
+        return frame;
+    }
+
+    Request DecodeRequest(std::string_view frame) {
+        Reader reader(frame);
+        Request request;
+        request.type = ToRequestType(reader.Read<uint8_t>());
+        request.request_id = reader.Read<uint32_t>();
+        request.status = ToStatus(reader.Read<uint8_t>());
+        request.document_id = reader.Read<int32_t>();
+        request.query = reader.ReadString();
+        return request;
+    }
+
+    Response DecodeResponse(std::string_view frame) {
+        Reader reader(frame);
+        Response response;
+        response.type = ToRequestType(reader.Read<uint8_t>());
+        response.request_id = reader.Read<uint32_t>();
+        response.code = static_cast<ResponseCode>(reader.Read<uint8_t>());
+
+        if (response.code == ResponseCode::ERROR) {
+            response.error = reader.ReadString();
+        }
+        else if (response.type == RequestType::FIND_TOP) {
+            const uint32_t count = reader.Read<uint32_t>();
+            for (uint32_t i = 0; i < count; ++i) {
+                const int32_t id = reader.Read<int32_t>();
+                const double relevance = reader.Read<double>();
+                const int32_t rating = reader.Read<int32_t>();
+                response.documents.emplace_back(id, relevance, rating);
+            }
+        }
+        else {
+            response.status = ToStatus(reader.Read<uint8_t>());
+            const uint32_t count = reader.Read<uint32_t>();
+            for (uint32_t i = 0; i < count; ++i) {
+                response.matched_words.push_back(reader.ReadString());
+            }
+        }
+
+        return response;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "document.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Бинарный протокол демона поиска. Каждый кадр - длина тела (uint32) и тело.
+// Числа передаются в порядке байт хоста: демон слушает только локальный сокет.
+namespace search_protocol {
+
+    enum class RequestType : uint8_t {
+        FIND_TOP = 1,
+        MATCH = 2,
+    };
+
+    enum class ResponseCode : uint8_t {
+        OK = 0,
+        ERROR = 1,
+    };
+
+    struct Request {
+        RequestType type = RequestType::FIND_TOP;
+        uint32_t request_id = 0;
+        DocumentStatus status = DocumentStatus::ACTUAL;
+        int32_t document_id = 0;
+        std::string query;
+    };
+
+    struct Response {
+        RequestType type = RequestType::FIND_TOP;
+        uint32_t request_id = 0;
+        ResponseCode code = ResponseCode::OK;
+        std::vector<Document> documents;
+        std::vector<std::string> matched_words;
+        DocumentStatus status = DocumentStatus::ACTUAL;
+        std::string error;
+    };
+
+    const size_t FRAME_HEADER_SIZE = sizeof(uint32_t);
+    const size_t MAX_FRAME_SIZE = 1 << 20;
+
+    void EncodeRequest(const Request& request, std::string& out);
+
+    void EncodeResponse(const Response& response, std::string& out);
+
+    // Извлекает из буфера один полный кадр, если он уже получен целиком.
+    // Бросает std::invalid_argument, если кадр превышает MAX_FRAME_SIZE.
+    std::optional<std::string_view> ExtractFrame(std::string_view& buffer);
+
+    Request DecodeRequest(std::string_view frame);
+
+    Response DecodeResponse(std::string_view frame);
+}
@@ -1,15 +1,29 @@
 #include "search_server.h"
 #include "string_processing.h"
+#include "index_snapshot.h"
 
-#include <future>
 #include <execution>
+#include <fstream>
+#include <queue>
 
 using namespace std::string_literals;
 
+namespace {
+
+    const size_t TREE_NODE_OVERHEAD = 4 * sizeof(void*);
+}
+
+    SearchServer::SearchServer(std::shared_ptr<TermDictionary> dictionary)
+        : dictionary_(std::move(dictionary)) {
+        if (!dictionary_) throw std::invalid_argument("Не задан словарь термов"s);
+    }
+
     void SearchServer::SetStopWords(std::string_view text) {
         if (!IsValid(text)) throw std::invalid_argument("Недопустимые знаки"s);
         for (const std::string& word : SplitIntoWords(text)) {
-            stop_words_.insert(word);
+            if (!dictionary_->IsStopWord(word)) {
+                stop_words_.insert(dictionary_->Intern(word));
+            }
         }
     }
 
@@ -19,50 +33,144 @@ using namespace std::string_literals;
         if (!IsValid(document)) throw std::invalid_argument("Недопустимые знаки"s);
         if (documents_.count(document_id)) throw std::invalid_argument("Документ с таким id уже есть"s + "("s + std::to_string(document_id) + ")");
 
+        IndexDocument(document_id, SplitIntoWordsNoStop(document), status, ratings);
+    }
+
+    void SearchServer::AddTokenizedDocument(int document_id, std::vector<std::string> words, DocumentStatus status, const std::vector<int>& ratings) {
+
+        if (document_id < 0) throw std::invalid_argument("Отрицательный id "s + std::to_string(document_id));
+        if (!std::all_of(words.begin(), words.end(), [this](const std::string& word) { return IsValid(word); })) throw std::invalid_argument("Недопустимые знаки"s);
+        if (documents_.count(document_id)) throw std::invalid_argument("Документ с таким id уже есть"s + "("s + std::to_string(document_id) + ")");
+
+        words.erase(std::remove_if(words.begin(), words.end(), [this](const std::string& word) { return IsStopWord(word); }), words.end());
+        IndexDocument(document_id, words, status, ratings);
+    }
+
+    void SearchServer::IndexDocument(int document_id, const std::vector<std::string>& words, DocumentStatus status, const std::vector<int>& ratings) {
+
+        PurgeTombstone(document_id);
         document_id_.insert(document_id);
-        const std::vector<std::string> words = SplitIntoWordsNoStop(document);
-        const double inv_word_count = 1.0 / words.size();
 
+        // Узлы map не перемещаются, поэтому счетчики можно дочитать после подсчета всех слов
+        std::vector<std::pair<WordPostings*, const uint32_t*>> new_postings;
+        std::set<std::string_view, std::less<>>& document_words = index_words_[document_id];
         for (const std::string& word : words) {
-            word_to_document_freqs_[word][document_id] += inv_word_count;
-            index_words_[document_id].insert(word);
+            // Общий словарь нужен только для терма, нового для этого сервера
+            auto word_it = word_to_document_freqs_.lower_bound(word);
+            if (word_it == word_to_document_freqs_.end() || word_it->first != word) {
+                word_it = word_to_document_freqs_.emplace_hint(word_it, dictionary_->Intern(word), WordPostings{});
+            }
+            WordPostings& postings = word_it->second;
+            uint32_t& term_count = postings.GetMutablePartition(static_cast<size_t>(status))[document_id];
+            if (++term_count == 1 && impact_min_postings_) {
+                new_postings.emplace_back(&postings, &term_count);
+            }
+            document_words.insert(word_it->first);
+            if (fuzzy_index_) {
+                fuzzy_index_->AddWord(word);
+            }
         }
 
         documents_.emplace(document_id,
             DocumentData{
                 ComputeAverageRating(ratings),
-                status
+                status,
+                AcquireSlot(document_id),
+                static_cast<uint32_t>(words.size())
             });        
+
+        for (const auto& [postings, term_count] : new_postings) {
+            AddImpact(*postings, document_id, *term_count, static_cast<uint32_t>(words.size()));
+        }
     }
 
     std::vector<Document> SearchServer::FindTopDocuments(std::string_view raw_query, DocumentStatus status) const {
-        return FindTopDocuments(std::execution::seq, raw_query, [status](int document_id, DocumentStatus status_document, int rating) { return status_document == status; });
+        return FindTopDocuments(std::execution::seq, raw_query, StatusEquals{ status });
     }
 
-    std::tuple<std::vector<std::string_view>, DocumentStatus> SearchServer::MatchDocument(const std::string_view raw_query, int document_id) const {
+    std::vector<Document> SearchServer::FindTopDocuments(std::string_view raw_query, const DocumentFilter& filter) const {
+        return FindTopDocuments(std::execution::seq, raw_query, filter);
+    }
+
+    std::vector<Document> SearchServer::FindTopDocuments(std::string_view raw_query, DocumentStatus status, QueryTrace& trace) const {
+        QueryTracer tracer(trace);
+        return FindTopDocumentsTraced<StatusEquals>(std::execution::seq, raw_query, StatusEquals{ status }, MAX_PREFIX_EXPANSION, tracer);
+    }
+
+    std::vector<Document> SearchServer::FindTopDocuments(std::string_view raw_query, const DocumentFilter& filter, QueryTrace& trace) const {
+        QueryTracer tracer(trace);
+        return FindTopDocumentsTraced<const DocumentFilter&>(std::execution::seq, raw_query, filter, MAX_PREFIX_EXPANSION, tracer);
+    }
+
+    std::vector<Document> SearchServer::FindTopDocuments(std::string_view raw_query, const DocumentFilter& filter, size_t prefix_expansion_limit) const {
+        NullTracer tracer;
+        return FindTopDocumentsTraced<const DocumentFilter&>(std::execution::seq, raw_query, filter, prefix_expansion_limit, tracer);
+    }
+
+    bool SearchServer::IsDocumentAccepted(int document_id, const DocumentFilter& filter) const {
+        const DocumentData& document = documents_.at(document_id);
+        return filter.HasStatus(document.status)
+            && document_id >= filter.GetMinId() && document_id <= filter.GetMaxId()
+            && filter.IsRatingAccepted(document.rating);
+    }
+
+    template<typename Tracer>
+    std::tuple<std::vector<std::string_view>, DocumentStatus> SearchServer::MatchDocumentTraced(const std::string_view raw_query, int document_id, Tracer& tracer) const {
 
         if (!IsValid(raw_query)) throw std::invalid_argument("Недопустимые знаки в запросе");
 
-        const Query query = ParseQuery(raw_query);
+        tracer.StartStage();
+        QueryArena arena;
+        const Query query = ParseQuery(raw_query, arena.Get());
         ValidParseWords(query);
+        tracer.FinishStage(QueryStage::PARSE);
+
         std::vector<std::string_view> matched_words;
 
-        for (const std::string& word : query.plus_words) {
-            if (IsContainWord(word) && IsContainWordId(word, document_id)) {
+        for (const std::string_view word : query.plus_words) {
+            const auto word_it = word_to_document_freqs_.find(word);
+            if (word_it == word_to_document_freqs_.end()) {
+                tracer.AddMissingTerm();
+                continue;
+            }
+            tracer.AddVisited(tracer.AddTerm(word, TermRole::PLUS, word_it->second.GetDocumentCount()));
+            if (IsContainWordId(word, document_id)) {
                 matched_words.push_back(std::string_view { *index_words_.at(document_id).find(word) });
             }
         }
 
-        for (const std::string& word : query.minus_words) {
-            if (IsContainWord(word) && IsContainWordId(word, document_id)) {
+        MatchPrefixes(query, document_id, matched_words);
+
+        for (const std::string_view word : query.minus_words) {
+            const auto word_it = word_to_document_freqs_.find(word);
+            if (word_it == word_to_document_freqs_.end()) {
+                tracer.AddMissingTerm();
+                continue;
+            }
+            tracer.AddVisited(tracer.AddTerm(word, TermRole::MINUS, word_it->second.GetDocumentCount()));
+            if (IsContainWordId(word, document_id)) {
                 matched_words.clear();
                 break;
             }
         }
+        tracer.SetResultCount(matched_words.size());
+        tracer.FinishStage(QueryStage::SCORE);
+
         return { matched_words, documents_.at(document_id).status };
     }
 
+    std::tuple<std::vector<std::string_view>, DocumentStatus> SearchServer::MatchDocument(const std::string_view raw_query, int document_id) const {
+        NullTracer tracer;
+        return MatchDocumentTraced(raw_query, document_id, tracer);
+    }
+
+    std::tuple<std::vector<std::string_view>, DocumentStatus> SearchServer::MatchDocument(const std::string_view raw_query, int document_id, QueryTrace& trace) const {
+        QueryTracer tracer(trace);
+        return MatchDocumentTraced(raw_query, document_id, tracer);
+    }
+
     int SearchServer::ComputeAverageRating(const std::vector<int>& ratings) {
+        if (ratings.empty()) return 0;
         int rating_sum = 0;
         for (const int rating : ratings) {
             rating_sum += rating;
@@ -76,24 +184,28 @@ using namespace std::string_literals;
             });
     }
 
-    void SearchServer::ValidWord(const std::string& word)const {
-        if (word == "") throw std::invalid_argument("Некорректное слово - " + word);
-        if (word.length() > 1 && word[0] == '-') throw std::invalid_argument("Перед словом два минуса - " + word);
+    void SearchServer::ValidWord(const std::string_view word)const {
+        if (word.empty()) throw std::invalid_argument("Некорректное слово - "s + std::string(word));
+        if (word.length() > 1 && word[0] == '-') throw std::invalid_argument("Перед словом два минуса - "s + std::string(word));
     }
 
-    void SearchServer::ValidParseWords(Query q) const {
+    void SearchServer::ValidParseWords(const Query& q) const {
 
-        auto valid_plus_words = std::async([&]() { 
-            for (const auto& word : q.plus_words) {
-                ValidWord(word);
-            }
-        });
+        for (const auto& word : q.plus_words) {
+            ValidWord(word);
+        }
 
         for (const auto& word : q.minus_words) {
             ValidWord(word);
         }
 
-        valid_plus_words.get();
+        for (const auto& prefix : q.plus_prefixes) {
+            ValidWord(prefix);
+        }
+
+        for (const auto& prefix : q.minus_prefixes) {
+            ValidWord(prefix);
+        }
     }
 
     std::vector<std::string> SearchServer::SplitIntoWordsNoStop(std::string_view text) const {
@@ -106,48 +218,89 @@ using namespace std::string_literals;
         return words;
     }
 
-    SearchServer::QueryWord SearchServer::ParseQueryWord(std::string text) const {
+    SearchServer::QueryWord SearchServer::ParseQueryWord(std::string_view text) const {
         bool is_minus = false;
+        bool is_prefix = false;
         if (!text.empty()) {
             if (text[0] == '-') {
                 is_minus = true;
-                text = text.substr(1);
+                text.remove_prefix(1);
             }
         }
+        if (!text.empty() && text.back() == '*') {
+            is_prefix = true;
+            text.remove_suffix(1);
+            if (text.empty()) throw std::invalid_argument("Пустой префикс в запросе"s);
+        }
         return {
             text,
             is_minus,
-            IsStopWord(text)
+            !is_prefix && IsStopWord(text),
+            is_prefix
         };
     }
 
-    SearchServer::Query SearchServer::ParseQuery(std::string_view text) const {
-        Query query;
-
-        auto split_word = SplitIntoWords(text);
-        std::mutex lock_minus;
-        std::mutex lock_plus;
+    SearchServer::Query SearchServer::ParseQuery(std::string_view text, std::pmr::memory_resource* resource) const {
+        Query query(resource);
 
-        std::for_each(split_word.begin(), split_word.end(),
-            [&](const std::string word) {
-                const QueryWord query_word = ParseQueryWord(word);
+        for (const std::string_view word : SplitIntoWordsView(text, resource)) {
+            const QueryWord query_word = ParseQueryWord(word);
 
-                if (!query_word.is_stop) {
-                    if (query_word.is_minus) {
-                        std::lock_guard guard_minus(lock_minus);
-                        query.minus_words.insert(query_word.data);
-                    }
-                    else {
-                        std::lock_guard guard_plus(lock_plus);
-                        query.plus_words.insert(query_word.data);
-                    }
+            if (query_word.is_prefix) {
+                if (query_word.is_minus) {
+                    query.minus_prefixes.insert(query_word.data);
+                }
+                else {
+                    query.plus_prefixes.insert(query_word.data);
+                }
+            }
+            else if (!query_word.is_stop) {
+                if (query_word.is_minus) {
+                    query.minus_words.insert(query_word.data);
+                }
+                else {
+                    query.plus_words.insert(query_word.data);
                 }
             }
-        );
+        }
+
+        if (fuzzy_index_) {
+            ExpandMisspelledWords(query);
+        }
 
         return query;
     }
 
+    void SearchServer::ExpandMisspelledWords(Query& query) const {
+        std::pmr::vector<std::string_view> misspelled(query.plus_words.get_allocator());
+        for (const std::string_view word : query.plus_words) {
+            const auto it = word_to_document_freqs_.find(word);
+            if (it == word_to_document_freqs_.end() || it->second.GetLiveDocumentCount() == 0) {
+                misspelled.push_back(word);
+            }
+        }
+
+        auto is_live = [this](const std::string& word) {
+            const auto it = word_to_document_freqs_.find(word);
+            return it != word_to_document_freqs_.end() && it->second.GetLiveDocumentCount() > 0;
+        };
+
+        for (const std::string_view word : misspelled) {
+            query.plus_words.erase(word);
+            for (const std::string& close_word : fuzzy_index_->FindClosest(word, is_live)) {
+                query.plus_words.insert(std::string_view{ word_to_document_freqs_.find(close_word)->first });
+            }
+        }
+    }
+
+    void SearchServer::EnableFuzzyLookup(const FuzzySettings& settings) {
+        FuzzyIndex index(settings);
+        for (const auto& [word, _] : word_to_document_freqs_) {
+            index.AddWord(std::string(word));
+        }
+        fuzzy_index_ = std::move(index);
+    }
+
     const std::map<std::string_view, double>& SearchServer::GetWordFrequencies(int document_id) const{
        
         static std::map<std::string_view, double> out;
@@ -155,40 +308,828 @@ using namespace std::string_literals;
 
         if (index_words_.empty() || !index_words_.count(document_id)) return out;        
 
+        const DocumentData& document = documents_.at(document_id);
+        const size_t status = static_cast<size_t>(document.status);
         for (const auto& word : index_words_.at(document_id)) {
-            out[word] = word_to_document_freqs_.at(word).at(document_id);
+            out[word] = static_cast<double>(*FindTermCount(word_to_document_freqs_.at(word), status, document_id)) / document.word_count;
         }       
 
         return out;
     } 
 
     void SearchServer::RemoveDocument(int document_id) {
+        if (!BuryDocument(document_id)) return;
 
-        if (!index_words_.count(document_id)) return;
+        if (tombstones_.size() * TOMBSTONE_COMPACTION_RATIO >= documents_.size() + tombstones_.size()) {
+            CompactIndex();
+        }
+    }
 
-        for (const auto& word : index_words_.at(document_id)) {
-            word_to_document_freqs_[word].erase(document_id);
+    bool SearchServer::BuryDocument(int document_id) {
+        auto words = index_words_.extract(document_id);
+        if (words.empty()) return false;
+
+        for (const std::string_view word : words.mapped()) {
+            ++word_to_document_freqs_.find(word)->second.tombstoned_count;
         }
 
+        const DocumentData& document = documents_.at(document_id);
+        tombstones_.emplace(document_id, Tombstone{ document.status, std::move(words.mapped()) });
+        free_slots_.push_back(document.slot);
+
         document_id_.erase(document_id);
         documents_.erase(document_id);
-        index_words_.erase(document_id);
+        return true;
     }
 
     void SearchServer::RemoveDocument(const std::execution::parallel_policy&, int document_id) {
+        RemoveDocument(document_id);
+    }
+
+    void SearchServer::CompactIndex() {
+        CompactTombstones(std::execution::seq);
+    }
+
+    void SearchServer::CompactIndex(const std::execution::parallel_policy& policy) {
+        CompactTombstones(policy);
+    }
+
+    template<class ExecutionPolicy>
+    void SearchServer::CompactTombstones(ExecutionPolicy&& policy) {
+        if (tombstones_.empty()) return;
+
+        using Sweep = std::pair<WordIndex::iterator, std::vector<std::pair<size_t, int>>>;
+        std::vector<Sweep> sweeps;
+        std::unordered_map<std::string_view, size_t> term_to_sweep;
+        for (const auto& [document_id, tombstone] : tombstones_) {
+            for (const std::string_view word : tombstone.words) {
+                const auto [it, inserted] = term_to_sweep.emplace(word, sweeps.size());
+                if (inserted) {
+                    sweeps.emplace_back(word_to_document_freqs_.find(word), std::vector<std::pair<size_t, int>>{});
+                }
+                sweeps[it->second].second.emplace_back(static_cast<size_t>(tombstone.status), document_id);
+            }
+        }
 
-        if (!index_words_.count(document_id)) return;
+        // Каждая задача меняет только деревья своего терма; словарь перестраивается после
+        std::for_each(policy, sweeps.begin(), sweeps.end(), [this](Sweep& sweep) {
+            RemovePostings(sweep.first, sweep.second);
+        });
+
+        for (const auto& [word_it, _] : sweeps) {
+            if (word_it->second.IsEmpty()) {
+                word_to_document_freqs_.erase(word_it);
+            }
+        }
+
+        tombstones_.clear();
+        RewriteColdStorageIfSparse();
+    }
+
+    void SearchServer::PurgeTombstone(int document_id) {
+        const auto it = tombstones_.find(document_id);
+        if (it == tombstones_.end()) return;
+
+        std::vector<std::pair<size_t, int>> removed{ { static_cast<size_t>(it->second.status), document_id } };
+        for (const std::string_view word : it->second.words) {
+            const auto word_it = word_to_document_freqs_.find(word);
+            RemovePostings(word_it, removed);
+            if (word_it->second.IsEmpty()) {
+                word_to_document_freqs_.erase(word_it);
+            }
+        }
+
+        tombstones_.erase(it);
+    }
+
+    void SearchServer::RemovePostings(WordIndex::iterator word_it, std::vector<std::pair<size_t, int>>& removed) {
+        WordPostings& postings = word_it->second;
+        std::sort(removed.begin(), removed.end());
+        // Снимаются только постинги документов с надгробиями
+        postings.tombstoned_count -= removed.size();
+
+        bool in_cold = false;
+        auto removed_it = removed.begin();
+        for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+            const auto removed_end = std::find_if(removed_it, removed.end(), [status](const auto& entry) { return entry.first != status; });
+            const size_t removed_count = static_cast<size_t>(removed_end - removed_it);
+            if (removed_count == 0) continue;
+            Postings& partition = postings.GetMutablePartition(status);
+
+            // Много удалений выгоднее снять одним проходом по дереву, чем искать каждое отдельно
+            if (removed_count * POSTING_SWEEP_RATIO >= partition.size()) {
+                auto it = partition.begin();
+                for (; removed_it != removed_end; ++removed_it) {
+                    while (it != partition.end() && it->first < removed_it->second) {
+                        ++it;
+                    }
+                    if (it != partition.end() && it->first == removed_it->second) {
+                        it = partition.erase(it);
+                    }
+                    else {
+                        in_cold = true;
+                    }
+                }
+            }
+            else {
+                for (; removed_it != removed_end; ++removed_it) {
+                    if (partition.erase(removed_it->second) == 0) {
+                        in_cold = true;
+                    }
+                }
+            }
+        }
+
+        // Холодный список неизменяем, поэтому дописываем в файл его копию без удаленных документов
+        if (in_cold && postings.cold) {
+            std::array<std::vector<ColdPosting>, DOCUMENT_STATUS_COUNT> partitions;
+            for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+                partitions[status].reserve(postings.cold->counts[status]);
+                ForEachColdPosting(postings, status, [&](int document_id, uint32_t term_count) {
+                    if (!std::binary_search(removed.begin(), removed.end(), std::pair{ status, document_id })) {
+                        partitions[status].push_back({ document_id, term_count });
+                    }
+                });
+            }
+
+            ResetColdPostings(postings);
+            if (std::any_of(partitions.begin(), partitions.end(), [](const auto& partition) { return !partition.empty(); })) {
+                postings.cold = std::make_unique<ColdPostingRef>(cold_store_->Append(partitions));
+            }
+        }
+
+        RemoveImpacts(postings, removed);
+    }
+
+    bool SearchServer::IsHigherImpact(const Impact& lhs, const Impact& rhs) {
+        return lhs.term_freq != rhs.term_freq ? lhs.term_freq > rhs.term_freq : lhs.document_id < rhs.document_id;
+    }
+
+    SearchServer::ImpactList SearchServer::MakeImpactList(std::vector<Impact> impacts) {
+        ImpactList list;
+        const size_t size = std::min(impacts.size(), IMPACT_LIST_SIZE);
+        std::partial_sort(impacts.begin(), impacts.begin() + size, impacts.end(), IsHigherImpact);
+        for (auto it = impacts.begin() + size; it != impacts.end(); ++it) {
+            list.floor = std::max(list.floor, it->term_freq);
+        }
+
+        // Вставка нового документа временно удлиняет список на один элемент
+        list.entries.reserve(IMPACT_LIST_SIZE + 1);
+        list.entries.assign(impacts.begin(), impacts.begin() + size);
+        return list;
+    }
+
+    void SearchServer::BuildImpactList(WordPostings& postings) {
+        std::vector<Impact> impacts;
+        impacts.reserve(postings.GetDocumentCount());
+        auto add = [this, &impacts](int document_id, uint32_t term_count) {
+            if (!IsTombstoned(document_id)) {
+                impacts.push_back({ static_cast<double>(term_count) / documents_.at(document_id).word_count, document_id, term_count });
+            }
+        };
+
+        for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+            for (const auto& [document_id, term_count] : postings.GetPartition(status)) {
+                add(document_id, term_count);
+            }
+            ForEachColdPosting(postings, status, add);
+        }
+        postings.impacts = std::make_unique<ImpactList>(MakeImpactList(std::move(impacts)));
+    }
+
+    void SearchServer::AddImpact(WordPostings& postings, int document_id, uint32_t term_count, uint32_t word_count) {
+        if (!postings.impacts) {
+            if (postings.GetDocumentCount() >= *impact_min_postings_) {
+                BuildImpactList(postings);
+            }
+            return;
+        }
+
+        ImpactList& list = *postings.impacts;
+        const Impact impact{ static_cast<double>(term_count) / word_count, document_id, term_count };
+        if (impact.term_freq <= list.floor) return;
+
+        list.entries.insert(std::upper_bound(list.entries.begin(), list.entries.end(), impact, IsHigherImpact), impact);
+        if (list.entries.size() > IMPACT_LIST_SIZE) {
+            list.floor = std::max(list.floor, list.entries.back().term_freq);
+            list.entries.pop_back();
+        }
+    }
+
+    void SearchServer::RemoveImpacts(WordPostings& postings, const std::vector<std::pair<size_t, int>>& removed) {
+        if (!postings.impacts) return;
 
-        std::for_each(std::execution::par, index_words_.at(document_id).begin(), index_words_.at(document_id).end(),
-            [&](const std::string& word) {
-                word_to_document_freqs_.at(word).erase(document_id);
+        // Порог снятия ниже порога построения, чтобы терм на границе не перестраивался постоянно
+        if (postings.GetDocumentCount() * 2 < *impact_min_postings_) {
+            postings.impacts.reset();
+            return;
+        }
+
+        std::vector<Impact>& entries = postings.impacts->entries;
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [&removed](const Impact& impact) {
+            for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+                if (std::binary_search(removed.begin(), removed.end(), std::pair{ status, impact.document_id })) return true;
+            }
+            return false;
+        }), entries.end());
+
+        if (entries.size() * 2 < IMPACT_LIST_SIZE && postings.impacts->floor > 0.0) {
+            BuildImpactList(postings);
+        }
+    }
+
+    void SearchServer::EnableImpactLists(size_t min_posting_count) {
+        impact_min_postings_ = min_posting_count;
+        for (auto& [_, postings] : word_to_document_freqs_) {
+            if (postings.GetDocumentCount() >= min_posting_count) {
+                BuildImpactList(postings);
+            }
+            else {
+                postings.impacts.reset();
+            }
+        }
+    }
+
+    void SearchServer::DisableImpactLists() {
+        impact_min_postings_.reset();
+        for (auto& [_, postings] : word_to_document_freqs_) {
+            postings.impacts.reset();
+        }
+    }
+
+    void SearchServer::ResetColdPostings(WordPostings& postings) {
+        if (!postings.cold) return;
+        cold_store_->Release(*postings.cold);
+        postings.cold.reset();
+    }
+
+    void SearchServer::RewriteColdStorageIfSparse() {
+        if (!cold_store_) return;
+
+        const ColdCacheMetrics metrics = cold_store_->GetMetrics();
+        if (metrics.file_bytes - metrics.live_bytes <= metrics.live_bytes) return;
+
+        // Новый файл пишется рядом со старым, старый удаляется вместе с прежним хранилищем
+        ColdStorageSettings settings = cold_settings_;
+        settings.path = ++cold_generation_ % 2 == 0 ? cold_settings_.path : cold_settings_.path + ".next"s;
+        auto store = std::make_shared<ColdPostingStore>(settings);
+
+        for (auto& [_, postings] : word_to_document_freqs_) {
+            if (!postings.cold) continue;
+
+            std::array<std::vector<ColdPosting>, DOCUMENT_STATUS_COUNT> partitions;
+            for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+                partitions[status].reserve(postings.cold->counts[status]);
+                ForEachColdPosting(postings, status, [&partitions, status](int document_id, uint32_t term_count) {
+                    partitions[status].push_back({ document_id, term_count });
+                });
+            }
+            postings.cold = std::make_unique<ColdPostingRef>(store->Append(partitions));
+        }
+        cold_store_ = std::move(store);
+    }
+
+    std::optional<uint32_t> SearchServer::FindTermCount(const WordPostings& postings, size_t status, int document_id) const {
+        const Postings& partition = postings.GetPartition(status);
+        const auto it = partition.find(document_id);
+        if (it != partition.end()) return it->second;
+
+        if (!postings.cold || postings.cold->counts[status] == 0) return std::nullopt;
+        return cold_store_->Find(postings.cold->GetPartitionOffset(status), postings.cold->counts[status], document_id);
+    }
+
+    void SearchServer::ThawPostings(WordPostings& postings) {
+        for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+            if (postings.cold->counts[status] == 0) continue;
+            Postings& partition = postings.GetMutablePartition(status);
+            ForEachColdPosting(postings, status, [&partition](int document_id, uint32_t term_count) {
+                partition.emplace_hint(partition.end(), document_id, term_count);
             });
+        }
+        ResetColdPostings(postings);
+    }
 
-        document_id_.erase(document_id);
-        documents_.erase(document_id);
-        index_words_.erase(document_id);
+    void SearchServer::EnableColdStorage(const ColdStorageSettings& settings) {
+        DisableColdStorage();
+        cold_store_ = std::make_shared<ColdPostingStore>(settings);
+        cold_settings_ = settings;
+        cold_generation_ = 0;
+        OffloadColdPostings();
+    }
+
+    void SearchServer::DisableColdStorage() {
+        if (!cold_store_) return;
+
+        for (auto& [_, postings] : word_to_document_freqs_) {
+            if (postings.cold) {
+                ThawPostings(postings);
+            }
+        }
+        cold_store_.reset();
+    }
+
+    void SearchServer::OffloadColdPostings() {
+        if (!cold_store_) return;
+
+        for (auto& [word, postings] : word_to_document_freqs_) {
+            if (postings.GetDocumentCount() < cold_settings_.min_posting_count || cold_settings_.resident_terms.count(word) > 0) continue;
+
+            std::array<std::vector<ColdPosting>, DOCUMENT_STATUS_COUNT> partitions;
+            bool has_hot = false;
+            for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+                const Postings& hot = postings.GetPartition(status);
+                has_hot = has_hot || !hot.empty();
+
+                // Новые документы могут иметь id меньше уже вынесенных, поэтому разделы сливаются
+                std::vector<ColdPosting>& partition = partitions[status];
+                partition.reserve(hot.size() + (postings.cold ? postings.cold->counts[status] : 0));
+                auto hot_it = hot.begin();
+                ForEachColdPosting(postings, status, [&](int document_id, uint32_t term_count) {
+                    for (; hot_it != hot.end() && hot_it->first < document_id; ++hot_it) {
+                        partition.push_back({ hot_it->first, hot_it->second });
+                    }
+                    partition.push_back({ document_id, term_count });
+                });
+                for (; hot_it != hot.end(); ++hot_it) {
+                    partition.push_back({ hot_it->first, hot_it->second });
+                }
+            }
+            if (!has_hot) continue;
+
+            ResetColdPostings(postings);
+            postings.cold = std::make_unique<ColdPostingRef>(cold_store_->Append(partitions));
+            postings.ClearPartitions();
+        }
+        RewriteColdStorageIfSparse();
+    }
+
+    ColdCacheMetrics SearchServer::GetColdCacheMetrics() const {
+        return cold_store_ ? cold_store_->GetMetrics() : ColdCacheMetrics{};
+    }
+
+    void SearchServer::LoadSnapshot(const std::string& path) {
+        if (!documents_.empty() || !tombstones_.empty()) throw std::logic_error("Снимок загружается только в пустой сервер"s);
+
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("Не удалось открыть файл "s + path);
+        index_snapshot::ReadMagic(in);
+
+        for (uint32_t count = index_snapshot::ReadValue<uint32_t>(in); count > 0; --count) {
+            const std::string word = index_snapshot::ReadString(in);
+            if (!IsValid(word)) throw std::invalid_argument("Недопустимые знаки"s);
+            if (!dictionary_->IsStopWord(word)) {
+                stop_words_.insert(dictionary_->Intern(word));
+            }
+        }
+
+        for (uint64_t count = index_snapshot::ReadValue<uint64_t>(in); count > 0; --count) {
+            const int document_id = index_snapshot::ReadValue<int32_t>(in);
+            const uint8_t status = index_snapshot::ReadValue<uint8_t>(in);
+            const int rating = index_snapshot::ReadValue<int32_t>(in);
+            const uint32_t word_count = index_snapshot::ReadValue<uint32_t>(in);
+
+            if (document_id < 0) throw std::invalid_argument("Отрицательный id "s + std::to_string(document_id));
+            if (status >= DOCUMENT_STATUS_COUNT) throw std::invalid_argument("Недопустимый статус документа "s + std::to_string(document_id));
+            if (documents_.count(document_id)) throw std::invalid_argument("Документ с таким id уже есть"s + "("s + std::to_string(document_id) + ")");
+
+            documents_.emplace(document_id, DocumentData{ rating, static_cast<DocumentStatus>(status), AcquireSlot(document_id), word_count });
+            document_id_.insert(document_id);
+        }
+
+        // Термы идут по возрастанию, поэтому словарь и прямой индекс заполняются вставкой в конец
+        std::string text;
+        std::array<std::vector<ColdPosting>, DOCUMENT_STATUS_COUNT> partitions;
+        while (index_snapshot::ReadTerm(in, text)) {
+            if (!word_to_document_freqs_.empty() && text <= word_to_document_freqs_.rbegin()->first) throw std::invalid_argument("Термы снимка не упорядочены"s);
+            const std::string_view word = dictionary_->Intern(text);
+
+            for (std::vector<ColdPosting>& partition : partitions) {
+                partition.clear();
+            }
+            int32_t document_id = 0;
+            uint32_t term_count = 0;
+            while (index_snapshot::ReadPosting(in, document_id, term_count)) {
+                const auto document_it = documents_.find(document_id);
+                if (document_it == documents_.end()) throw std::invalid_argument("Терм ссылается на неизвестный документ "s + std::to_string(document_id));
+
+                partitions[static_cast<size_t>(document_it->second.status)].push_back({ document_id, term_count });
+                std::set<std::string_view, std::less<>>& words = index_words_[document_id];
+                words.emplace_hint(words.end(), word);
+            }
+
+            WordPostings& postings = word_to_document_freqs_.emplace_hint(word_to_document_freqs_.end(), word, WordPostings{})->second;
+            size_t posting_count = 0;
+            for (const std::vector<ColdPosting>& partition : partitions) {
+                posting_count += partition.size();
+            }
+
+            if (cold_store_ && posting_count >= cold_settings_.min_posting_count && cold_settings_.resident_terms.count(word) == 0) {
+                postings.cold = std::make_unique<ColdPostingRef>(cold_store_->Append(partitions));
+            }
+            else {
+                for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+                    if (partitions[status].empty()) continue;
+                    Postings& partition = postings.GetMutablePartition(status);
+                    for (const auto& [id, count] : partitions[status]) {
+                        partition.emplace_hint(partition.end(), id, count);
+                    }
+                }
+            }
+
+            if (fuzzy_index_) {
+                fuzzy_index_->AddWord(text);
+            }
+            if (impact_min_postings_ && posting_count >= *impact_min_postings_) {
+                BuildImpactList(postings);
+            }
+        }
+    }
+
+    void SearchServer::SaveSnapshot(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("Не удалось открыть файл "s + path);
+        index_snapshot::WriteMagic(out);
+
+        std::set<std::string_view, std::less<>> stop_words = dictionary_->GetStopWords();
+        stop_words.insert(stop_words_.begin(), stop_words_.end());
+        index_snapshot::WriteValue<uint32_t>(out, static_cast<uint32_t>(stop_words.size()));
+        for (const std::string_view word : stop_words) {
+            index_snapshot::WriteString(out, word);
+        }
+
+        index_snapshot::WriteValue<uint64_t>(out, documents_.size());
+        for (const auto& [document_id, document] : documents_) {
+            index_snapshot::WriteValue<int32_t>(out, document_id);
+            index_snapshot::WriteValue<uint8_t>(out, static_cast<uint8_t>(document.status));
+            index_snapshot::WriteValue<int32_t>(out, document.rating);
+            index_snapshot::WriteValue<uint32_t>(out, document.word_count);
+        }
+
+        std::vector<std::pair<int, uint32_t>> merged;
+        for (const auto& [word, postings] : word_to_document_freqs_) {
+            merged.clear();
+            auto add = [this, &merged](int document_id, uint32_t term_count) {
+                if (!IsTombstoned(document_id)) {
+                    merged.emplace_back(document_id, term_count);
+                }
+            };
+            for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+                for (const auto& [document_id, term_count] : postings.GetPartition(status)) {
+                    add(document_id, term_count);
+                }
+                ForEachColdPosting(postings, status, add);
+            }
+            if (merged.empty()) continue;
+            std::sort(merged.begin(), merged.end());
+
+            index_snapshot::WriteString(out, word);
+            for (const auto& [document_id, term_count] : merged) {
+                index_snapshot::WriteValue<int32_t>(out, document_id);
+                index_snapshot::WriteValue<uint32_t>(out, term_count);
+            }
+            index_snapshot::WriteValue<int32_t>(out, index_snapshot::END_OF_POSTINGS);
+        }
+
+        out.close();
+        if (!out) throw std::runtime_error("Ошибка записи снимка "s + path);
+    }
+
+    uint32_t SearchServer::AcquireSlot(int document_id) {
+        uint32_t slot = static_cast<uint32_t>(slot_to_document_.size());
+        if (!free_slots_.empty()) {
+            slot = free_slots_.back();
+            free_slots_.pop_back();
+            slot_to_document_[slot] = document_id;
+        }
+        else {
+            slot_to_document_.push_back(document_id);
+        }
+
+        // Редкий большой id не раздувает массив: его слот найдется через documents_
+        const size_t id = static_cast<size_t>(document_id);
+        const size_t limit = std::max(SLOT_TABLE_ID_RATIO * (documents_.size() + 1), SLOT_TABLE_MIN_SIZE);
+        if (id >= document_to_slot_.size() && id < limit) {
+            const size_t old_size = document_to_slot_.size();
+            document_to_slot_.resize(std::min(std::max(id + 1, old_size * 2), limit), NO_SLOT);
+            for (auto it = documents_.lower_bound(static_cast<int>(old_size)); it != documents_.end() && static_cast<size_t>(it->first) < document_to_slot_.size(); ++it) {
+                document_to_slot_[it->first] = it->second.slot;
+            }
+        }
+        if (id < document_to_slot_.size()) {
+            document_to_slot_[id] = slot;
+        }
+        return slot;
+    }
+
+    bool SearchServer::IsDenseAccumulationPreferred(size_t estimated_hits) const {
+        if (accumulator_mode_ != AccumulatorMode::AUTO) return accumulator_mode_ == AccumulatorMode::DENSE;
+        return estimated_hits * DENSE_ACCUMULATOR_RATIO >= documents_.size();
+    }
+
+    SearchServer::ExecutionPlan SearchServer::PlanQuery(const Query& query, std::pmr::memory_resource* resource) const {
+        ExecutionPlan plan(resource);
+
+        size_t estimated_hits = 0;
+        for (const std::string_view word : query.plus_words) {
+            const auto it = word_to_document_freqs_.find(word);
+            if (it == word_to_document_freqs_.end() || it->second.GetLiveDocumentCount() == 0) continue;
+
+            const size_t posting_count = it->second.GetLiveDocumentCount();
+            plan.plus_words.push_back({ it, posting_count, ExclusionStrategy::MERGE });
+            estimated_hits += posting_count;
+        }
+        std::sort(plan.plus_words.begin(), plan.plus_words.end(), [](const PlannedWord& lhs, const PlannedWord& rhs) {
+            return lhs.posting_count < rhs.posting_count;
+        });
+
+        plan.estimated_candidates = std::min(estimated_hits, documents_.size());
+        plan.use_dense = IsDenseAccumulationPreferred(estimated_hits);
+
+        // Кандидатов от префиксов заранее не оценить, поэтому с ними проверка по набору слов документа не выбирается
+        const bool probe_allowed = query.plus_prefixes.empty();
+        for (const std::string_view word : query.minus_words) {
+            const auto it = word_to_document_freqs_.find(word);
+            if (it == word_to_document_freqs_.end() || it->second.GetLiveDocumentCount() == 0) continue;
+
+            const size_t posting_count = it->second.GetLiveDocumentCount();
+            ExclusionStrategy strategy = plan.use_dense ? ExclusionStrategy::PREFILTER : ExclusionStrategy::MERGE;
+            if (probe_allowed && posting_count > plan.estimated_candidates * PROBE_COST_RATIO) {
+                strategy = ExclusionStrategy::PROBE;
+                plan.has_probes = true;
+            }
+            plan.minus_words.push_back({ it, posting_count, strategy });
+        }
+        // Частые минус-слова проверяются первыми, чтобы раньше отсеять документ
+        std::sort(plan.minus_words.begin(), plan.minus_words.end(), [](const PlannedWord& lhs, const PlannedWord& rhs) {
+            return lhs.posting_count > rhs.posting_count;
+        });
+
+        return plan;
+    }
+
+    bool SearchServer::IsExcludedByProbe(int document_id, const ExecutionPlan& plan) const {
+        const auto& words = index_words_.at(document_id);
+        for (const PlannedWord& planned : plan.minus_words) {
+            if (planned.strategy == ExclusionStrategy::PROBE && words.count(planned.word->first) > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    QueryPlan SearchServer::Explain(const std::string_view raw_query) const {
+        if (!IsValid(raw_query)) throw std::invalid_argument("Недопустимые знаки в запросе");
+
+        QueryArena arena;
+        const Query query = ParseQuery(raw_query, arena.Get());
+        ValidParseWords(query);
+        const ExecutionPlan plan = PlanQuery(query, arena.Get());
+
+        QueryPlan result;
+        for (const PlannedWord& planned : plan.plus_words) {
+            result.plus_terms.push_back({ std::string(planned.word->first), planned.posting_count, planned.strategy });
+        }
+        for (const PlannedWord& planned : plan.minus_words) {
+            result.minus_terms.push_back({ std::string(planned.word->first), planned.posting_count, planned.strategy });
+        }
+        result.plus_prefix_count = query.plus_prefixes.size();
+        result.minus_prefix_count = query.minus_prefixes.size();
+        result.estimated_candidates = plan.estimated_candidates;
+        result.document_count = documents_.size();
+        result.dense_accumulator = plan.use_dense;
+        return result;
     }
     
-    double SearchServer::ComputeWordInverseDocumentFreq(const std::string& word) const {
-        return log(GetDocumentCount() * 1.0 / static_cast<double>(word_to_document_freqs_.at(word).size()));
-    }
\ No newline at end of file
+    double SearchServer::ComputeWordInverseDocumentFreq(const WordPostings& postings) const {
+        return log(GetDocumentCount() * 1.0 / static_cast<double>(postings.GetLiveDocumentCount()));
+    }
+
+    std::pmr::vector<SearchServer::WordIndex::const_iterator> SearchServer::ExpandPrefix(const std::string_view prefix, size_t limit, std::pmr::memory_resource* resource) const {
+        std::pmr::vector<WordIndex::const_iterator> words(resource);
+
+        for (auto it = word_to_document_freqs_.lower_bound(prefix);
+            it != word_to_document_freqs_.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+            if (it->second.GetLiveDocumentCount() > 0) {
+                words.push_back(it);
+            }
+        }
+
+        if (words.size() > limit) {
+            std::partial_sort(words.begin(), words.begin() + limit, words.end(),
+                [](const auto lhs, const auto rhs) {
+                    return lhs->second.GetLiveDocumentCount() > rhs->second.GetLiveDocumentCount();
+                });
+            words.resize(limit);
+        }
+
+        return words;
+    }
+
+    std::pmr::vector<std::pair<int, double>> SearchServer::MergePrefixPostings(const std::string_view prefix, size_t limit, std::pmr::set<std::string_view>& expanded, std::pmr::memory_resource* resource) const {
+        using PostingIt = Postings::const_iterator;
+
+        // Холодные разделы читаются в буфер запроса, горячие обходятся по дереву
+        struct Cursor {
+            PostingIt current;
+            PostingIt end;
+            const ColdPosting* cold_current;
+            const ColdPosting* cold_end;
+            double inverse_document_freq;
+
+            inline int GetDocumentId() const {
+                return cold_current ? cold_current->document_id : current->first;
+            }
+
+            inline uint32_t GetTermCount() const {
+                return cold_current ? cold_current->term_count : current->second;
+            }
+
+            inline bool Advance() {
+                return cold_current ? ++cold_current != cold_end : ++current != end;
+            }
+        };
+
+        std::pmr::vector<WordIndex::const_iterator> words(resource);
+        for (const auto word_it : ExpandPrefix(prefix, limit, resource)) {
+            if (expanded.insert(word_it->first).second) {
+                words.push_back(word_it);
+            }
+        }
+
+        size_t cold_count = 0;
+        for (const auto word_it : words) {
+            cold_count += word_it->second.cold ? word_it->second.cold->GetDocumentCount() : 0;
+        }
+        std::pmr::vector<ColdPosting> cold_postings(resource);
+        cold_postings.reserve(cold_count);
+
+        std::pmr::vector<Cursor> cursors(resource);
+        cursors.reserve(words.size());
+        for (const auto word_it : words) {
+            const double inverse_document_freq = ComputeWordInverseDocumentFreq(word_it->second);
+            for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+                const Postings& partition = word_it->second.GetPartition(status);
+                if (!partition.empty()) {
+                    cursors.push_back({ partition.begin(), partition.end(), nullptr, nullptr, inverse_document_freq });
+                }
+
+                const size_t cold_begin = cold_postings.size();
+                ForEachColdPosting(word_it->second, status, [&cold_postings](int document_id, uint32_t term_count) {
+                    cold_postings.push_back({ document_id, term_count });
+                });
+                if (cold_postings.size() > cold_begin) {
+                    const ColdPosting* data = cold_postings.data();
+                    cursors.push_back({ partition.end(), partition.end(), data + cold_begin, data + cold_postings.size(), inverse_document_freq });
+                }
+            }
+        }
+
+        auto greater_id = [&cursors](size_t lhs, size_t rhs) {
+            return cursors[lhs].GetDocumentId() > cursors[rhs].GetDocumentId();
+        };
+        std::priority_queue<size_t, std::pmr::vector<size_t>, decltype(greater_id)> heap(greater_id, std::pmr::vector<size_t>(resource));
+        for (size_t i = 0; i < cursors.size(); ++i) {
+            heap.push(i);
+        }
+
+        std::pmr::vector<std::pair<int, double>> merged(resource);
+        while (!heap.empty()) {
+            const size_t i = heap.top();
+            heap.pop();
+
+            Cursor& cursor = cursors[i];
+            const int document_id = cursor.GetDocumentId();
+            if (!IsTombstoned(document_id)) {
+                const double relevance = cursor.GetTermCount() * cursor.inverse_document_freq;
+                if (!merged.empty() && merged.back().first == document_id) {
+                    merged.back().second += relevance;
+                }
+                else {
+                    merged.emplace_back(document_id, relevance);
+                }
+            }
+
+            if (cursor.Advance()) {
+                heap.push(i);
+            }
+        }
+
+        return merged;
+    }
+
+    void SearchServer::MatchPrefixes(const Query& query, int document_id, std::vector<std::string_view>& matched_words) const {
+        const std::set<std::string_view, std::less<>>& words = index_words_.at(document_id);
+
+        auto has_prefix = [](const std::string_view word, const std::string_view prefix) {
+            return word.compare(0, prefix.size(), prefix) == 0;
+        };
+
+        for (const std::string_view prefix : query.minus_prefixes) {
+            const auto it = words.lower_bound(prefix);
+            if (it != words.end() && has_prefix(*it, prefix)) {
+                matched_words.clear();
+                return;
+            }
+        }
+
+        if (query.plus_prefixes.empty()) return;
+        for (const std::string_view prefix : query.plus_prefixes) {
+            for (auto it = words.lower_bound(prefix); it != words.end() && has_prefix(*it, prefix); ++it) {
+                matched_words.push_back(std::string_view{ *it });
+            }
+        }
+
+        // Слово может совпасть с плюс-словом и с несколькими префиксами, в ответе оно одно
+        std::sort(matched_words.begin(), matched_words.end());
+        matched_words.erase(std::unique(matched_words.begin(), matched_words.end()), matched_words.end());
+    }
+
+    IndexStats SearchServer::GetIndexStats(size_t top_count) const {
+        IndexStats stats;
+        stats.term_count = word_to_document_freqs_.size();
+        stats.document_count = documents_.size();
+        stats.tombstone_count = tombstones_.size();
+
+        const size_t posting_node_bytes = TREE_NODE_OVERHEAD + sizeof(Postings::value_type);
+        const size_t forward_node_bytes = TREE_NODE_OVERHEAD + sizeof(std::string_view);
+
+        auto longer = [](const std::pair<std::string_view, size_t>& lhs, const std::pair<std::string_view, size_t>& rhs) {
+            return lhs.second > rhs.second;
+        };
+        std::priority_queue<std::pair<std::string_view, size_t>, std::vector<std::pair<std::string_view, size_t>>, decltype(longer)> longest(longer);
+
+        // Постинги удаленных документов лежат в списках до уплотнения; их число ограничено
+        // TOMBSTONE_COMPACTION_RATIO, поэтому обходятся только они, а не все постинги
+        struct TombstonedPostings {
+            size_t count = 0;
+            size_t hot_count = 0;
+        };
+        std::unordered_map<std::string_view, TombstonedPostings> tombstoned;
+        for (const auto& [document_id, tombstone] : tombstones_) {
+            for (const std::string_view word : tombstone.words) {
+                TombstonedPostings& entry = tombstoned[word];
+                ++entry.count;
+                entry.hot_count += word_to_document_freqs_.find(word)->second.GetPartition(static_cast<size_t>(tombstone.status)).count(document_id);
+            }
+        }
+        stats.tombstone_bytes = tombstones_.size() * (TREE_NODE_OVERHEAD + sizeof(decltype(tombstones_)::value_type));
+
+        for (const auto& [word, postings] : word_to_document_freqs_) {
+            const auto tombstoned_it = tombstoned.find(word);
+            const TombstonedPostings dead = tombstoned_it == tombstoned.end() ? TombstonedPostings{} : tombstoned_it->second;
+            const size_t length = postings.GetDocumentCount() - dead.count;
+            const size_t cold_length = postings.cold ? postings.cold->GetDocumentCount() - (dead.count - dead.hot_count) : 0;
+
+            stats.posting_count += length;
+            stats.tombstoned_posting_count += dead.count;
+            stats.cold_posting_count += cold_length;
+            stats.term_dictionary_bytes += TREE_NODE_OVERHEAD + sizeof(WordIndex::value_type);
+            stats.postings_bytes += (length - cold_length) * posting_node_bytes;
+            if (postings.other_statuses) {
+                stats.postings_bytes += sizeof(*postings.other_statuses);
+            }
+            if (postings.cold) {
+                stats.postings_bytes += sizeof(ColdPostingRef);
+            }
+            if (postings.impacts) {
+                ++stats.impact_list_count;
+                stats.postings_bytes += sizeof(ImpactList) + postings.impacts->entries.capacity() * sizeof(Impact);
+            }
+            stats.forward_index_bytes += length * forward_node_bytes;
+            stats.tombstone_bytes += dead.hot_count * posting_node_bytes + dead.count * forward_node_bytes;
+            if (length == 0) continue;
+
+            size_t bound = 1;
+            while (bound < length) {
+                bound <<= 1;
+            }
+            ++stats.posting_length_histogram[bound];
+
+            if (top_count > 0) {
+                longest.emplace(word, length);
+                if (longest.size() > top_count) {
+                    longest.pop();
+                }
+            }
+        }
+
+        stats.longest_postings.resize(longest.size());
+        for (auto it = stats.longest_postings.rbegin(); it != stats.longest_postings.rend(); ++it) {
+            *it = { std::string(longest.top().first), longest.top().second };
+            longest.pop();
+        }
+
+        stats.forward_index_bytes += index_words_.size() * (TREE_NODE_OVERHEAD + sizeof(decltype(index_words_)::value_type));
+        stats.document_table_bytes = documents_.size() * (TREE_NODE_OVERHEAD + sizeof(decltype(documents_)::value_type))
+            + document_id_.size() * (TREE_NODE_OVERHEAD + sizeof(int))
+            + slot_to_document_.capacity() * sizeof(int)
+            + document_to_slot_.capacity() * sizeof(uint32_t)
+            + free_slots_.capacity() * sizeof(uint32_t);
+
+        stats.stop_words_bytes = stop_words_.size() * (TREE_NODE_OVERHEAD + sizeof(std::string_view));
+        stats.shared_dictionary_bytes = dictionary_->GetBytes();
+
+        stats.cold_file_bytes = GetColdCacheMetrics().file_bytes;
+        stats.average_terms_per_document = documents_.empty() ? 0.0 : static_cast<double>(stats.posting_count) / documents_.size();
+        return stats;
+    }
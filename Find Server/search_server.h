@@ -1,20 +1,53 @@
 #pragma once
 
 #include "document.h"
-
+#include "document_filter.h"
+#include "document_predicate.h"
+#include "fuzzy_index.h"
+#include "query_arena.h"
+#include "dense_accumulator.h"
+#include "index_stats.h"
+#include "query_plan.h"
+#include "query_trace.h"
+#include "cold_postings.h"
+#include "term_dictionary.h"
+
+#include <array>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <string>
 #include <iostream>
 #include <vector>
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <cmath>
 #include <execution>
 #include <string_view>
 #include <mutex>
+#include <optional>
+#include <memory>
+#include <memory_resource>
 
 const int MAX_RESULT_DOCUMENT_COUNT = 5;
+const size_t MAX_PREFIX_EXPANSION = 64;
+const size_t DENSE_ACCUMULATOR_RATIO = 16;
+const size_t TOMBSTONE_COMPACTION_RATIO = 8;
+const size_t PROBE_COST_RATIO = 4;
+const size_t POSTING_SWEEP_RATIO = 16;
+const size_t IMPACT_LIST_MIN_POSTINGS = 1024;
+const size_t SLOT_TABLE_ID_RATIO = 2;
+const size_t SLOT_TABLE_MIN_SIZE = 1024;
+const uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+const size_t IMPACT_LIST_SIZE = 64;
+const double RELEVANCE_EPSILON = 1e-6;
+
+enum class AccumulatorMode {
+    AUTO,
+    SPARSE,
+    DENSE,
+};
 
 class SearchServer {
 public:
@@ -29,15 +62,35 @@ public:
         SetStopWords(stop_words_text);
     }
 
+    // Подключает сервер к общему словарю: строки термов и стоп-слова словаря
+    // разделяются со всеми его серверами, постинги у каждого сервера свои
+    explicit SearchServer(std::shared_ptr<TermDictionary> dictionary);
+
     template <typename StringContainer>
     explicit SearchServer(const StringContainer& stop_words);
 
+    // Стоп-слова этого сервера в дополнение к стоп-словам общего словаря
     void SetStopWords(const std::string_view text);
 
     void AddDocument(int document_id, const std::string_view document, DocumentStatus status, const std::vector<int>& ratings);
 
+    void AddTokenizedDocument(int document_id, std::vector<std::string> words, DocumentStatus status, const std::vector<int>& ratings);
+
     std::vector<Document> FindTopDocuments(const std::string_view raw_query, DocumentStatus status = DocumentStatus::ACTUAL) const;
 
+    std::vector<Document> FindTopDocuments(const std::string_view raw_query, const DocumentFilter& filter) const;
+
+    std::vector<Document> FindTopDocuments(const std::string_view raw_query, DocumentStatus status, QueryTrace& trace) const;
+
+    std::vector<Document> FindTopDocuments(const std::string_view raw_query, const DocumentFilter& filter, QueryTrace& trace) const;
+
+    // Плюс-префикс запроса раскрывается не более чем в prefix_expansion_limit самых частых термов
+    // (по умолчанию MAX_PREFIX_EXPANSION); минус-префикс исключает документы со всеми своими термами
+    std::vector<Document> FindTopDocuments(const std::string_view raw_query, const DocumentFilter& filter, size_t prefix_expansion_limit) const;
+
+    template<class ExecutionPolicy>
+    std::vector<Document> FindTopDocuments(ExecutionPolicy&& policy, const std::string_view raw_query, const DocumentFilter& filter) const;
+
     template<typename KeyMapper, class ExecutionPolicy>
     std::vector<Document> FindTopDocuments(ExecutionPolicy&& policy, const std::string_view raw_query, KeyMapper key_mapper) const;
 
@@ -48,7 +101,7 @@ public:
 
     template<class ExecutionPolicy >
     std::vector<Document> FindTopDocuments(ExecutionPolicy&& policy, const std::string_view raw_query, DocumentStatus status = DocumentStatus::ACTUAL) const {
-        return FindTopDocuments(policy, raw_query, [status](int document_id, DocumentStatus status_document, int rating) { return status_document == status; });
+        return FindTopDocuments(policy, raw_query, StatusEquals{ status });
     }
 
     inline int GetDocumentCount() const noexcept {
@@ -57,6 +110,8 @@ public:
 
     std::tuple<std::vector<std::string_view>, DocumentStatus> MatchDocument(const std::string_view raw_query, int document_id) const;
 
+    std::tuple<std::vector<std::string_view>, DocumentStatus> MatchDocument(const std::string_view raw_query, int document_id, QueryTrace& trace) const;
+
     template<class ExecutionPolicy>
     std::tuple<std::vector<std::string_view>, DocumentStatus> MatchDocument(ExecutionPolicy&& policy, const std::string_view raw_query, int document_id) const;
 
@@ -70,6 +125,28 @@ public:
     
     void RemoveDocument(const std::execution::parallel_policy&, int document_id);
 
+    // Снимает документы с учета за один проход и сразу чистит индекс:
+    // каждый затронутый список обходится один раз, списки разных термов - параллельно
+    template<class ExecutionPolicy, typename DocumentIds>
+    void RemoveDocuments(ExecutionPolicy&& policy, const DocumentIds& document_ids);
+
+    template<typename DocumentIds>
+    void RemoveDocuments(const DocumentIds& document_ids) {
+        RemoveDocuments(std::execution::seq, document_ids);
+    }
+
+    void CompactIndex();
+
+    void CompactIndex(const std::execution::sequenced_policy&) {
+        CompactIndex();
+    }
+
+    void CompactIndex(const std::execution::parallel_policy&);
+
+    inline size_t GetTombstoneCount() const noexcept {
+        return tombstones_.size();
+    }
+
     inline std::set<int>::const_iterator begin() noexcept {
         return document_id_.cbegin();
     }
@@ -78,64 +155,366 @@ public:
         return document_id_.cend();
     }
 
-    inline const std::set<std::string>& GetIdsWords(int document_id) const {
+    inline const std::set<std::string_view, std::less<>>& GetIdsWords(int document_id) const {
         return index_words_.at(document_id);
     }
 
+    inline const std::shared_ptr<TermDictionary>& GetTermDictionary() const noexcept {
+        return dictionary_;
+    }
+
+    void EnableFuzzyLookup(const FuzzySettings& settings = {});
+
+    inline void DisableFuzzyLookup() noexcept {
+        fuzzy_index_.reset();
+    }
+
+    inline bool IsFuzzyLookupEnabled() const noexcept {
+        return fuzzy_index_.has_value();
+    }
+
+    inline void SetAccumulatorMode(AccumulatorMode mode) noexcept {
+        accumulator_mode_ = mode;
+    }
+
+    IndexStats GetIndexStats(size_t top_count = 10) const;
+
+    void EnableColdStorage(const ColdStorageSettings& settings);
+
+    void DisableColdStorage();
+
+    inline bool IsColdStorageEnabled() const noexcept {
+        return cold_store_ != nullptr;
+    }
+
+    // Выносит на диск списки, ставшие длинными или пополненные после предыдущего вызова
+    void OffloadColdPostings();
+
+    ColdCacheMetrics GetColdCacheMetrics() const;
+
+    // Термы, встречающиеся хотя бы в min_posting_count документах, хранят top-N документов по tf.
+    // Запрос из одного плюс-слова отвечается по этому списку, если список гарантированно
+    // содержит весь результат, иначе ранжируется полностью.
+    void EnableImpactLists(size_t min_posting_count = IMPACT_LIST_MIN_POSTINGS);
+
+    void DisableImpactLists();
+
+    inline bool IsImpactListsEnabled() const noexcept {
+        return impact_min_postings_.has_value();
+    }
+
+    QueryPlan Explain(const std::string_view raw_query) const;
+
+    // Загружает снимок индекса (формат index_snapshot.h) в пустой сервер
+    void LoadSnapshot(const std::string& path);
+
+    void SaveSnapshot(const std::string& path) const;
+
+    static int ComputeAverageRating(const std::vector<int>& ratings);
+
 private:
 
     struct DocumentData {
         int rating;
         DocumentStatus status;
+        uint32_t slot;
+        uint32_t word_count;
     };
 
     struct QueryWord {
-        std::string data;
+        std::string_view data;
         bool is_minus;
         bool is_stop;
+        bool is_prefix;
     };
 
     struct Query {
-        std::set<std::string> plus_words;
-        std::set<std::string> minus_words;
+        explicit Query(std::pmr::memory_resource* resource)
+            : plus_words(resource)
+            , minus_words(resource)
+            , plus_prefixes(resource)
+            , minus_prefixes(resource) {
+        }
+
+        std::pmr::set<std::string_view> plus_words;
+        std::pmr::set<std::string_view> minus_words;
+        std::pmr::set<std::string_view> plus_prefixes;
+        std::pmr::set<std::string_view> minus_prefixes;
+        size_t prefix_expansion_limit = MAX_PREFIX_EXPANSION;
+    };
+
+    // Хранится число вхождений терма, tf = term_count / word_count документа.
+    // Ранжирование копит сумму term_count * idf и делит ее на word_count один раз на документ,
+    // поэтому tf не накапливает погрешность. Для k слагаемых (термы и раскрытые префиксы)
+    // относительное отклонение релевантности от точного значения не больше (k + 1) * 2^-53,
+    // что много меньше порога 1e-6 при сравнении документов.
+    using Postings = std::map<int, uint32_t>;
+
+    struct Impact {
+        double term_freq;
+        int document_id;
+        uint32_t term_count;
+    };
+
+    // Документы по убыванию tf; у любого документа терма вне списка tf не больше floor.
+    // Удаленные документы пропускаются при чтении и вычищаются вместе с постингами.
+    struct ImpactList {
+        std::vector<Impact> entries;
+        double floor = 0.0;
+    };
+
+    // Часть списка может лежать на диске; новые документы всегда добавляются в память.
+    // Запись есть у каждого терма каждого сервера, поэтому в ней хранится только раздел ACTUAL,
+    // а разделы остальных статусов, холодный список и список импактов создаются при первой записи:
+    // значение занимает 80 байт вместо 272
+    struct WordPostings {
+        WordPostings() = default;
+
+        WordPostings(const WordPostings& other)
+            : actual(other.actual)
+            , other_statuses(Clone(other.other_statuses))
+            , cold(Clone(other.cold))
+            , impacts(Clone(other.impacts))
+            , tombstoned_count(other.tombstoned_count) {
+        }
+
+        WordPostings(WordPostings&&) = default;
+
+        WordPostings& operator=(const WordPostings& other) {
+            return *this = WordPostings(other);
+        }
+
+        WordPostings& operator=(WordPostings&&) = default;
+
+        Postings actual;
+        std::unique_ptr<std::array<Postings, DOCUMENT_STATUS_COUNT - 1>> other_statuses;
+        std::unique_ptr<ColdPostingRef> cold;
+        std::unique_ptr<ImpactList> impacts;
+        // Постинги удаленных документов, еще не снятые уплотнением
+        size_t tombstoned_count = 0;
+
+        inline const Postings& GetPartition(size_t status) const noexcept {
+            static const Postings empty;
+            if (status == 0) return actual;
+            return other_statuses ? (*other_statuses)[status - 1] : empty;
+        }
+
+        inline Postings& GetMutablePartition(size_t status) {
+            if (status == 0) return actual;
+            if (!other_statuses) {
+                other_statuses = std::make_unique<std::array<Postings, DOCUMENT_STATUS_COUNT - 1>>();
+            }
+            return (*other_statuses)[status - 1];
+        }
+
+        inline void ClearPartitions() noexcept {
+            actual.clear();
+            other_statuses.reset();
+        }
+
+        // Вместе с постингами удаленных документов
+        inline size_t GetDocumentCount() const noexcept {
+            size_t count = cold ? cold->GetDocumentCount() : 0;
+            for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+                count += GetPartition(status).size();
+            }
+            return count;
+        }
+
+        inline bool IsEmpty() const noexcept {
+            return GetDocumentCount() == 0;
+        }
+
+        // Документная частота терма для idf и планирования: удаленные документы в ней не считаются,
+        // иначе до уплотнения ранжирование отличалось бы от индекса без этих документов
+        inline size_t GetLiveDocumentCount() const noexcept {
+            return GetDocumentCount() - tombstoned_count;
+        }
+
+        template <typename T>
+        static std::unique_ptr<T> Clone(const std::unique_ptr<T>& value) {
+            return value ? std::make_unique<T>(*value) : nullptr;
+        }
+    };
+
+    // Ключи указывают на строки общего словаря
+    using WordIndex = std::map<std::string_view, WordPostings, std::less<>>;
+
+    struct PlannedWord {
+        WordIndex::const_iterator word;
+        size_t posting_count;
+        ExclusionStrategy strategy;
+    };
+
+    struct ExecutionPlan {
+        explicit ExecutionPlan(std::pmr::memory_resource* resource)
+            : plus_words(resource)
+            , minus_words(resource) {
+        }
+
+        std::pmr::vector<PlannedWord> plus_words;
+        std::pmr::vector<PlannedWord> minus_words;
+        size_t estimated_candidates = 0;
+        bool use_dense = false;
+        bool has_probes = false;
     };
 
-    std::set<std::string> stop_words_;
-    std::map<std::string, std::map<int, double>> word_to_document_freqs_;
+    struct Tombstone {
+        DocumentStatus status;
+        std::set<std::string_view, std::less<>> words;
+    };
+
+    std::shared_ptr<TermDictionary> dictionary_ = std::make_shared<TermDictionary>();
+    std::set<std::string_view, std::less<>> stop_words_;
+    WordIndex word_to_document_freqs_;
     std::map<int, DocumentData> documents_;
-    std::map<int, std::set<std::string>> index_words_;
+    std::map<int, std::set<std::string_view, std::less<>>> index_words_;
     std::set<int> document_id_;
-
-    static int ComputeAverageRating(const std::vector<int>& ratings);
+    std::optional<FuzzyIndex> fuzzy_index_;
+    AccumulatorMode accumulator_mode_ = AccumulatorMode::AUTO;
+    std::vector<int> slot_to_document_;
+    // Слот по id документа для плотного накопителя: обход постингов читает его из массива,
+    // а не из дерева documents_. У удаленных id значение устаревшее, но их постинги пропускаются.
+    // Массив растет, только пока id плотные (не больше SLOT_TABLE_ID_RATIO * число документов),
+    // слоты остальных id берутся из documents_ (см. GetSlot)
+    std::vector<uint32_t> document_to_slot_;
+    std::vector<uint32_t> free_slots_;
+    std::unordered_map<int, Tombstone> tombstones_;
+    std::shared_ptr<ColdPostingStore> cold_store_;
+    ColdStorageSettings cold_settings_;
+    size_t cold_generation_ = 0;
+    std::optional<size_t> impact_min_postings_ = IMPACT_LIST_MIN_POSTINGS;
 
     bool IsValid(const std::string_view words) const;
 
-    void ValidWord(const std::string& word) const;
+    void ValidWord(const std::string_view word) const;
 
-    void ValidParseWords(Query q) const;
+    void ValidParseWords(const Query& q) const;
 
-    inline bool IsStopWord(const std::string& word) const {
-        return stop_words_.count(word) > 0;
+    inline bool IsStopWord(const std::string_view word) const {
+        return dictionary_->IsStopWord(word) || stop_words_.count(word) > 0;
     }
 
-    inline bool IsContainWord(const std::string& word) const noexcept {
+    inline bool IsContainWord(const std::string_view word) const noexcept {
         return word_to_document_freqs_.count(word);
     }
 
-    inline bool IsContainWordId(const std::string& word, int document_id) const noexcept {
-        return word_to_document_freqs_.at(word).count(document_id);
+    inline bool IsContainWordId(const std::string_view word, int document_id) const {
+        const size_t status = static_cast<size_t>(documents_.at(document_id).status);
+        return FindTermCount(word_to_document_freqs_.find(word)->second, status, document_id).has_value();
     }
 
+    std::optional<uint32_t> FindTermCount(const WordPostings& postings, size_t status, int document_id) const;
+
+    void RemovePostings(WordIndex::iterator word_it, std::vector<std::pair<size_t, int>>& removed);
+
+    void ThawPostings(WordPostings& postings);
+
+    void ResetColdPostings(WordPostings& postings);
+
+    void RewriteColdStorageIfSparse();
+
+    template<typename Function>
+    void ForEachColdPosting(const WordPostings& postings, size_t status, Function function) const;
+
+    static bool IsHigherImpact(const Impact& lhs, const Impact& rhs);
+
+    static ImpactList MakeImpactList(std::vector<Impact> impacts);
+
+    void BuildImpactList(WordPostings& postings);
+
+    void AddImpact(WordPostings& postings, int document_id, uint32_t term_count, uint32_t word_count);
+
+    void RemoveImpacts(WordPostings& postings, const std::vector<std::pair<size_t, int>>& removed);
+
     std::vector<std::string> SplitIntoWordsNoStop(const std::string_view text) const;
 
-    QueryWord ParseQueryWord(std::string text) const;
+    QueryWord ParseQueryWord(std::string_view text) const;
 
-    Query ParseQuery(const std::string_view text) const;
+    Query ParseQuery(const std::string_view text, std::pmr::memory_resource* resource) const;
 
-    double ComputeWordInverseDocumentFreq(const std::string& word) const;
+    void ExpandMisspelledWords(Query& query) const;
 
-    template<typename KeyMapper, class ExecutionPolicy>
-    std::vector<Document> FindAllDocuments(ExecutionPolicy&& policy, const Query& query, KeyMapper key_mapper) const;
+    double ComputeWordInverseDocumentFreq(const WordPostings& postings) const;
+
+    // Непустые термы с префиксом prefix; если их больше limit, остаются limit самых частых
+    std::pmr::vector<WordIndex::const_iterator> ExpandPrefix(const std::string_view prefix, size_t limit, std::pmr::memory_resource* resource) const;
+
+    // Суммы term_count * idf по раскрытым термам, еще не деленные на длину документа.
+    // Термы из expanded пропускаются, новые добавляются в него: терм, который уже дали
+    // плюс-слова или другой префикс запроса, учитывается один раз
+    std::pmr::vector<std::pair<int, double>> MergePrefixPostings(const std::string_view prefix, size_t limit, std::pmr::set<std::string_view>& expanded, std::pmr::memory_resource* resource) const;
+
+    void MatchPrefixes(const Query& query, int document_id, std::vector<std::string_view>& matched_words) const;
+
+    void IndexDocument(int document_id, const std::vector<std::string>& words, DocumentStatus status, const std::vector<int>& ratings);
+
+    uint32_t AcquireSlot(int document_id);
+
+    inline uint32_t GetSlot(int document_id) const {
+        if (static_cast<size_t>(document_id) < document_to_slot_.size() && document_to_slot_[document_id] != NO_SLOT) {
+            return document_to_slot_[document_id];
+        }
+        return documents_.at(document_id).slot;
+    }
+
+    bool BuryDocument(int document_id);
+
+    template<class ExecutionPolicy>
+    void CompactTombstones(ExecutionPolicy&& policy);
+
+    void PurgeTombstone(int document_id);
+
+    inline bool IsTombstoned(int document_id) const {
+        return !tombstones_.empty() && tombstones_.count(document_id) > 0;
+    }
+
+    bool IsDenseAccumulationPreferred(size_t estimated_hits) const;
+
+    ExecutionPlan PlanQuery(const Query& query, std::pmr::memory_resource* resource) const;
+
+    bool IsExcludedByProbe(int document_id, const ExecutionPlan& plan) const;
+
+    template<typename Function>
+    void ForEachPosting(const WordPostings& postings, const DocumentFilter& filter, Function function) const;
+
+    template<typename KeyMapper, typename Function>
+    void ForEachPosting(const WordPostings& postings, KeyMapper key_mapper, Function function) const;
+
+    template<typename Function>
+    void ForEachCandidate(const WordPostings& postings, const DocumentFilter& filter, Function function) const;
+
+    template<typename KeyMapper, typename Function>
+    void ForEachCandidate(const WordPostings& postings, KeyMapper key_mapper, Function function) const;
+
+    bool IsDocumentAccepted(int document_id, const DocumentFilter& filter) const;
+
+    template<typename KeyMapper>
+    bool IsDocumentAccepted(int document_id, KeyMapper key_mapper) const;
+
+    template<typename Tracer>
+    std::tuple<std::vector<std::string_view>, DocumentStatus> MatchDocumentTraced(const std::string_view raw_query, int document_id, Tracer& tracer) const;
+
+    template<typename Tracer>
+    void TracePlan(const Query& query, const ExecutionPlan& plan, Tracer& tracer) const;
+
+    template<typename Tracer>
+    void TraceProbes(const ExecutionPlan& plan, Tracer& tracer) const;
+
+    template<typename KeyMapper, class ExecutionPolicy, typename Tracer>
+    std::vector<Document> FindTopDocumentsTraced(ExecutionPolicy&& policy, const std::string_view raw_query, KeyMapper key_mapper, size_t prefix_expansion_limit, Tracer& tracer) const;
+
+    template<typename KeyMapper, class ExecutionPolicy, typename Tracer>
+    std::vector<Document> FindAllDocuments(ExecutionPolicy&& policy, const Query& query, KeyMapper key_mapper, std::pmr::memory_resource* resource, Tracer& tracer) const;
+
+    template<typename KeyMapper, typename Tracer>
+    std::optional<std::vector<Document>> FindAllDocumentsByImpact(const Query& query, KeyMapper key_mapper, Tracer& tracer) const;
+
+    template<typename KeyMapper, class ExecutionPolicy, typename Tracer>
+    std::vector<Document> FindAllDocumentsSparse(ExecutionPolicy&& policy, const Query& query, const ExecutionPlan& plan, KeyMapper key_mapper, std::pmr::memory_resource* resource, Tracer& tracer) const;
+
+    template<typename KeyMapper, class ExecutionPolicy, typename Tracer>
+    std::vector<Document> FindAllDocumentsDense(ExecutionPolicy&& policy, const Query& query, const ExecutionPlan& plan, KeyMapper key_mapper, std::pmr::memory_resource* resource, Tracer& tracer) const;
 };
 
 template <typename StringContainer>
@@ -157,62 +536,402 @@ SearchServer::SearchServer(const StringContainer& stop_words) {
 
 template<typename KeyMapper, class ExecutionPolicy>
 std::vector<Document> SearchServer::FindTopDocuments(ExecutionPolicy&& policy, const std::string_view raw_query, KeyMapper key_mapper) const {
+    NullTracer tracer;
+    return FindTopDocumentsTraced<KeyMapper>(policy, raw_query, key_mapper, MAX_PREFIX_EXPANSION, tracer);
+}
+
+template<typename KeyMapper, class ExecutionPolicy, typename Tracer>
+std::vector<Document> SearchServer::FindTopDocumentsTraced(ExecutionPolicy&& policy, const std::string_view raw_query, KeyMapper key_mapper, size_t prefix_expansion_limit, Tracer& tracer) const {
 
     if (!IsValid(raw_query)) throw std::invalid_argument("Недопустимые знаки в запросе");
 
-    const Query query = ParseQuery(raw_query);
+    tracer.StartStage();
+    QueryArena arena;
+    Query query = ParseQuery(raw_query, arena.Get());
     ValidParseWords(query);
-    auto matched_documents = FindAllDocuments(policy, query, key_mapper);
+    query.prefix_expansion_limit = prefix_expansion_limit;
+    tracer.FinishStage(QueryStage::PARSE);
 
+    std::optional<std::vector<Document>> impact_documents = FindAllDocumentsByImpact<KeyMapper>(query, key_mapper, tracer);
+    auto matched_documents = impact_documents
+        ? std::move(*impact_documents)
+        : FindAllDocuments<KeyMapper>(policy, query, key_mapper, arena.Get(), tracer);
+
+    // id различает равноценные документы, чтобы результат не зависел от порядка кандидатов
     std::sort(policy, matched_documents.begin(), matched_documents.end(),
         [](const Document& lhs, const Document& rhs) {
-            return ((std::abs(lhs.relevance - rhs.relevance)) < 1e-6) ?
-                lhs.rating > rhs.rating : lhs.relevance > rhs.relevance;
+            if (std::abs(lhs.relevance - rhs.relevance) >= RELEVANCE_EPSILON) return lhs.relevance > rhs.relevance;
+            return lhs.rating != rhs.rating ? lhs.rating > rhs.rating : lhs.id < rhs.id;
         });
 
     if (matched_documents.size() > MAX_RESULT_DOCUMENT_COUNT) {
         matched_documents.resize(MAX_RESULT_DOCUMENT_COUNT);
     }
+    tracer.FinishStage(QueryStage::SORT);
 
     return matched_documents;
 }
 
-template<typename KeyMapper, class ExecutionPolicy>
-std::vector<Document> SearchServer::FindAllDocuments(ExecutionPolicy&& policy, const Query& query, KeyMapper key_mapper) const {
-    std::map<int, double> document_to_relevance;
-    std::mutex stop_insert_map;
+template<class ExecutionPolicy>
+std::vector<Document> SearchServer::FindTopDocuments(ExecutionPolicy&& policy, const std::string_view raw_query, const DocumentFilter& filter) const {
+    return FindTopDocuments<const DocumentFilter&>(policy, raw_query, filter);
+}
 
-    std::for_each(policy, query.plus_words.begin(), query.plus_words.end(),
-        [&](const std::string& word){
-            if (word_to_document_freqs_.count(word) != 0) {
-
-                const double inverse_document_freq = ComputeWordInverseDocumentFreq(word);
-                for (const auto& [document_id, term_freq] : word_to_document_freqs_.at(word)) {
-                    if (key_mapper(document_id, documents_.at(document_id).status, documents_.at(document_id).rating)) {
-                        std::lock_guard guard_map(stop_insert_map);
-                        document_to_relevance[document_id] += term_freq * inverse_document_freq;
-                    }
-                }
+template<class ExecutionPolicy, typename DocumentIds>
+void SearchServer::RemoveDocuments(ExecutionPolicy&& policy, const DocumentIds& document_ids) {
+    for (const int document_id : document_ids) {
+        BuryDocument(document_id);
+    }
+    CompactIndex(policy);
+}
+
+template<typename Function>
+void SearchServer::ForEachPosting(const WordPostings& postings, const DocumentFilter& filter, Function function) const {
+    const bool check_rating = filter.HasRatingRange();
+
+    for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+        if (!filter.HasStatus(static_cast<DocumentStatus>(status))) continue;
+
+        const Postings& partition = postings.GetPartition(status);
+        const auto end = partition.upper_bound(filter.GetMaxId());
+        for (auto it = partition.lower_bound(filter.GetMinId()); it != end; ++it) {
+            if (IsTombstoned(it->first)) continue;
+            if (!check_rating || filter.IsRatingAccepted(documents_.at(it->first).rating)) {
+                function(it->first, it->second);
+            }
+        }
+
+        ForEachColdPosting(postings, status, [&](int document_id, uint32_t term_count) {
+            if (document_id < filter.GetMinId() || document_id > filter.GetMaxId() || IsTombstoned(document_id)) return;
+            if (!check_rating || filter.IsRatingAccepted(documents_.at(document_id).rating)) {
+                function(document_id, term_count);
             }
         });
+    }
+}
 
-    std::mutex stop_erase_map;
-    std::for_each(policy, query.minus_words.begin(), query.minus_words.end(),
-        [&](const std::string& word) {
-            if (word_to_document_freqs_.count(word) != 0) {
-                for (const auto& [document_id, _] : word_to_document_freqs_.at(word)) {
-                    std::lock_guard guard_map(stop_erase_map);
-                    document_to_relevance.erase(document_id);
+template<typename KeyMapper, typename Function>
+void SearchServer::ForEachPosting(const WordPostings& postings, KeyMapper key_mapper, Function function) const {
+    for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+        auto visit = [&](int document_id, uint32_t term_count) {
+            if (IsTombstoned(document_id)) return;
+            if constexpr (IsDocumentPredicate<KeyMapper>::value) {
+                if constexpr (std::decay_t<KeyMapper>::NEEDS_RATING) {
+                    if (!key_mapper.IsRatingAccepted(documents_.at(document_id).rating)) return;
                 }
+                function(document_id, term_count);
+            }
+            else if (key_mapper(document_id, static_cast<DocumentStatus>(status), documents_.at(document_id).rating)) {
+                function(document_id, term_count);
+            }
+        };
+
+        if constexpr (IsDocumentPredicate<KeyMapper>::value) {
+            if (!key_mapper.HasStatus(static_cast<DocumentStatus>(status))) continue;
+        }
+
+        for (const auto& [document_id, term_count] : postings.GetPartition(status)) {
+            visit(document_id, term_count);
+        }
+        ForEachColdPosting(postings, status, visit);
+    }
+}
+
+template<typename Function>
+void SearchServer::ForEachCandidate(const WordPostings& postings, const DocumentFilter& filter, Function function) const {
+    for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+        if (!filter.HasStatus(static_cast<DocumentStatus>(status))) continue;
+
+        const Postings& partition = postings.GetPartition(status);
+        const auto end = partition.upper_bound(filter.GetMaxId());
+        for (auto it = partition.lower_bound(filter.GetMinId()); it != end; ++it) {
+            if (!IsTombstoned(it->first)) {
+                function(it->first);
+            }
+        }
+
+        ForEachColdPosting(postings, status, [&](int document_id, uint32_t) {
+            if (document_id >= filter.GetMinId() && document_id <= filter.GetMaxId() && !IsTombstoned(document_id)) {
+                function(document_id);
+            }
+        });
+    }
+}
+
+template<typename KeyMapper, typename Function>
+void SearchServer::ForEachCandidate(const WordPostings& postings, [[maybe_unused]] KeyMapper key_mapper, Function function) const {
+    for (size_t status = 0; status < DOCUMENT_STATUS_COUNT; ++status) {
+        // Документы чужих статусов не попадут в результат, исключать их незачем
+        if constexpr (IsDocumentPredicate<KeyMapper>::value) {
+            if (!key_mapper.HasStatus(static_cast<DocumentStatus>(status))) continue;
+        }
+
+        for (const auto& [document_id, _] : postings.GetPartition(status)) {
+            if (!IsTombstoned(document_id)) {
+                function(document_id);
+            }
+        }
+
+        ForEachColdPosting(postings, status, [&](int document_id, uint32_t) {
+            if (!IsTombstoned(document_id)) {
+                function(document_id);
             }
         });
+    }
+}
+
+template<typename Function>
+void SearchServer::ForEachColdPosting(const WordPostings& postings, size_t status, Function function) const {
+    if (!postings.cold || postings.cold->counts[status] == 0) return;
+    cold_store_->ForEach(postings.cold->GetPartitionOffset(status), postings.cold->counts[status], function);
+}
+
+template<typename KeyMapper>
+bool SearchServer::IsDocumentAccepted(int document_id, KeyMapper key_mapper) const {
+    const DocumentData& document = documents_.at(document_id);
+    return key_mapper(document_id, document.status, document.rating);
+}
+
+template<typename Tracer>
+void SearchServer::TracePlan(const Query& query, const ExecutionPlan& plan, Tracer& tracer) const {
+    if constexpr (Tracer::IS_ENABLED) {
+        for (const PlannedWord& planned : plan.plus_words) {
+            tracer.AddTerm(planned.word->first, TermRole::PLUS, planned.posting_count);
+        }
+        for (const PlannedWord& planned : plan.minus_words) {
+            tracer.AddTerm(planned.word->first, TermRole::MINUS, planned.posting_count);
+        }
+        const size_t missing = query.plus_words.size() + query.minus_words.size() - plan.plus_words.size() - plan.minus_words.size();
+        for (size_t i = 0; i < missing; ++i) {
+            tracer.AddMissingTerm();
+        }
+    }
+}
+
+template<typename Tracer>
+void SearchServer::TraceProbes(const ExecutionPlan& plan, Tracer& tracer) const {
+    if constexpr (Tracer::IS_ENABLED) {
+        for (size_t i = 0; i < plan.minus_words.size(); ++i) {
+            if (plan.minus_words[i].strategy == ExclusionStrategy::PROBE) {
+                tracer.AddVisited(plan.plus_words.size() + i);
+            }
+        }
+    }
+}
+
+template<typename KeyMapper, class ExecutionPolicy, typename Tracer>
+std::vector<Document> SearchServer::FindAllDocuments(ExecutionPolicy&& policy, const Query& query, KeyMapper key_mapper, std::pmr::memory_resource* resource, Tracer& tracer) const {
+    const ExecutionPlan plan = PlanQuery(query, resource);
+    TracePlan(query, plan, tracer);
+    tracer.FinishStage(QueryStage::PLAN);
+
+    auto matched_documents = plan.use_dense
+        ? FindAllDocumentsDense<KeyMapper>(policy, query, plan, key_mapper, resource, tracer)
+        : FindAllDocumentsSparse<KeyMapper>(policy, query, plan, key_mapper, resource, tracer);
+    tracer.SetResultCount(matched_documents.size());
+    tracer.FinishStage(QueryStage::SCORE);
+
+    return matched_documents;
+}
+
+template<typename KeyMapper, typename Tracer>
+std::optional<std::vector<Document>> SearchServer::FindAllDocumentsByImpact(const Query& query, KeyMapper key_mapper, Tracer& tracer) const {
+    if (query.plus_words.size() != 1 || !query.plus_prefixes.empty() || !query.minus_prefixes.empty()) return std::nullopt;
+
+    const auto word_it = word_to_document_freqs_.find(*query.plus_words.begin());
+    if (word_it == word_to_document_freqs_.end() || !word_it->second.impacts || word_it->second.GetLiveDocumentCount() == 0) return std::nullopt;
+
+    const ImpactList& impacts = *word_it->second.impacts;
+    const double inverse_document_freq = ComputeWordInverseDocumentFreq(word_it->second);
+    // При неположительном idf порядок по tf не совпадает с порядком по релевантности
+    if (inverse_document_freq <= 0.0) return std::nullopt;
+
+    // Сортировка считает равными документы с разницей релевантности меньше RELEVANCE_EPSILON,
+    // поэтому кандидаты собираются, пока tf не опустится ниже последнего из лучших с запасом.
+    // Кандидаты идут по убыванию tf, так что последний из лучших - элемент MAX_RESULT_DOCUMENT_COUNT - 1.
+    auto is_below_result = [&](double term_freq, const std::vector<Document>& matched) {
+        return matched.size() >= MAX_RESULT_DOCUMENT_COUNT
+            && matched[MAX_RESULT_DOCUMENT_COUNT - 1].relevance - term_freq * inverse_document_freq > 2 * RELEVANCE_EPSILON;
+    };
+
+    std::vector<Document> matched_documents;
+    bool is_complete = false;
+    size_t visited = 0;
+    size_t scored = 0;
+    for (const Impact& impact : impacts.entries) {
+        if (is_below_result(impact.term_freq, matched_documents)) {
+            is_complete = true;
+            break;
+        }
+        ++visited;
+        if (IsTombstoned(impact.document_id) || !IsDocumentAccepted(impact.document_id, key_mapper)) continue;
+        ++scored;
+
+        const std::set<std::string_view, std::less<>>& words = index_words_.at(impact.document_id);
+        if (std::any_of(query.minus_words.begin(), query.minus_words.end(), [&words](const std::string_view word) { return words.count(word) > 0; })) continue;
+
+        const DocumentData& document = documents_.at(impact.document_id);
+        matched_documents.push_back({
+            impact.document_id,
+            impact.term_count * inverse_document_freq / document.word_count,
+            document.rating
+            });
+    }
+    if (!is_complete && impacts.floor > 0.0 && !is_below_result(impacts.floor, matched_documents)) return std::nullopt;
+
+    tracer.AddVisited(tracer.AddTerm(word_it->first, TermRole::PLUS, word_it->second.GetDocumentCount()), visited);
+    tracer.SetScoredCount(scored);
+    tracer.SetResultCount(matched_documents.size());
+    tracer.FinishStage(QueryStage::SCORE);
+    return matched_documents;
+}
+
+template<typename KeyMapper, class ExecutionPolicy, typename Tracer>
+std::vector<Document> SearchServer::FindAllDocumentsDense(ExecutionPolicy&& policy, const Query& query, const ExecutionPlan& plan, KeyMapper key_mapper, std::pmr::memory_resource* resource, Tracer& tracer) const {
+    DenseAccumulatorScope scope(slot_to_document_.size());
+    DenseAccumulator& accumulator = scope.Get();
+    std::mutex stop_insert_accumulator;
+
+    for (const PlannedWord& planned : plan.minus_words) {
+        if (planned.strategy != ExclusionStrategy::PREFILTER) continue;
+        const size_t term = plan.plus_words.size() + (&planned - plan.minus_words.data());
+        ForEachCandidate(planned.word->second, key_mapper, [&](int document_id) {
+            tracer.AddVisited(term);
+            accumulator.Exclude(GetSlot(document_id));
+        });
+    }
+
+    std::for_each(policy, plan.plus_words.begin(), plan.plus_words.end(),
+        [&](const PlannedWord& planned) {
+            const size_t term = &planned - plan.plus_words.data();
+            const double inverse_document_freq = ComputeWordInverseDocumentFreq(planned.word->second);
+            ForEachPosting(planned.word->second, key_mapper, [&](int document_id, uint32_t term_count) {
+                const uint32_t slot = GetSlot(document_id);
+                std::lock_guard guard_accumulator(stop_insert_accumulator);
+                tracer.AddVisited(term);
+                accumulator.Add(slot, term_count * inverse_document_freq);
+            });
+        });
+
+    std::pmr::set<std::string_view> expanded(query.plus_words.begin(), query.plus_words.end(), resource);
+    for (const std::string_view prefix : query.plus_prefixes) {
+        const auto merged = MergePrefixPostings(prefix, query.prefix_expansion_limit, expanded, resource);
+        const size_t term = tracer.AddTerm(prefix, TermRole::PLUS_PREFIX, merged.size());
+        for (const auto& [document_id, relevance] : merged) {
+            if (IsDocumentAccepted(document_id, key_mapper)) {
+                tracer.AddVisited(term);
+                accumulator.Add(GetSlot(document_id), relevance);
+            }
+        }
+    }
+    if constexpr (Tracer::IS_ENABLED) {
+        tracer.SetScoredCount(accumulator.GetScoredCount());
+    }
+
+    std::for_each(policy, plan.minus_words.begin(), plan.minus_words.end(),
+        [&](const PlannedWord& planned) {
+            if (planned.strategy != ExclusionStrategy::MERGE) return;
+            const size_t term = plan.plus_words.size() + (&planned - plan.minus_words.data());
+            ForEachCandidate(planned.word->second, key_mapper, [&](int document_id) {
+                const uint32_t slot = GetSlot(document_id);
+                std::lock_guard guard_accumulator(stop_insert_accumulator);
+                tracer.AddVisited(term);
+                accumulator.Exclude(slot);
+            });
+        });
+
+    for (const std::string_view prefix : query.minus_prefixes) {
+        for (const auto word_it : ExpandPrefix(prefix, std::numeric_limits<size_t>::max(), resource)) {
+            const size_t term = tracer.AddTerm(word_it->first, TermRole::MINUS_PREFIX, word_it->second.GetDocumentCount());
+            ForEachCandidate(word_it->second, key_mapper, [&](int document_id) {
+                tracer.AddVisited(term);
+                accumulator.Exclude(GetSlot(document_id));
+            });
+        }
+    }
+
+    std::vector<Document> matched_documents;
+    matched_documents.reserve(accumulator.GetTouchedCount());
+    accumulator.ForEachScored([&](uint32_t slot, double relevance) {
+        const int document_id = slot_to_document_[slot];
+        if (plan.has_probes) {
+            TraceProbes(plan, tracer);
+            if (IsExcludedByProbe(document_id, plan)) return;
+        }
+        const DocumentData& document = documents_.at(document_id);
+        matched_documents.push_back({
+            document_id,
+            relevance / document.word_count,
+            document.rating
+            });
+    });
+
+    return matched_documents;
+}
+
+template<typename KeyMapper, class ExecutionPolicy, typename Tracer>
+std::vector<Document> SearchServer::FindAllDocumentsSparse(ExecutionPolicy&& policy, const Query& query, const ExecutionPlan& plan, KeyMapper key_mapper, std::pmr::memory_resource* resource, Tracer& tracer) const {
+    std::pmr::map<int, double> document_to_relevance(resource);
+    std::mutex stop_insert_map;
+
+    std::for_each(policy, plan.plus_words.begin(), plan.plus_words.end(),
+        [&](const PlannedWord& planned){
+            const size_t term = &planned - plan.plus_words.data();
+            const double inverse_document_freq = ComputeWordInverseDocumentFreq(planned.word->second);
+            ForEachPosting(planned.word->second, key_mapper, [&](int document_id, uint32_t term_count) {
+                std::lock_guard guard_map(stop_insert_map);
+                tracer.AddVisited(term);
+                document_to_relevance[document_id] += term_count * inverse_document_freq;
+            });
+        });
+
+    std::pmr::set<std::string_view> expanded(query.plus_words.begin(), query.plus_words.end(), resource);
+    for (const std::string_view prefix : query.plus_prefixes) {
+        const auto merged = MergePrefixPostings(prefix, query.prefix_expansion_limit, expanded, resource);
+        const size_t term = tracer.AddTerm(prefix, TermRole::PLUS_PREFIX, merged.size());
+        for (const auto& [document_id, relevance] : merged) {
+            if (IsDocumentAccepted(document_id, key_mapper)) {
+                tracer.AddVisited(term);
+                document_to_relevance[document_id] += relevance;
+            }
+        }
+    }
+    tracer.SetScoredCount(document_to_relevance.size());
+
+    std::mutex stop_erase_map;
+    std::for_each(policy, plan.minus_words.begin(), plan.minus_words.end(),
+        [&](const PlannedWord& planned) {
+            if (planned.strategy != ExclusionStrategy::MERGE) return;
+            const size_t term = plan.plus_words.size() + (&planned - plan.minus_words.data());
+            ForEachCandidate(planned.word->second, key_mapper, [&](int document_id) {
+                std::lock_guard guard_map(stop_erase_map);
+                tracer.AddVisited(term);
+                document_to_relevance.erase(document_id);
+            });
+        });
+
+    for (const std::string_view prefix : query.minus_prefixes) {
+        for (const auto word_it : ExpandPrefix(prefix, std::numeric_limits<size_t>::max(), resource)) {
+            const size_t term = tracer.AddTerm(word_it->first, TermRole::MINUS_PREFIX, word_it->second.GetDocumentCount());
+            ForEachCandidate(word_it->second, key_mapper, [&](int document_id) {
+                tracer.AddVisited(term);
+                document_to_relevance.erase(document_id);
+            });
+        }
+    }
 
     std::vector<Document> matched_documents;
+    matched_documents.reserve(document_to_relevance.size());
     for (const auto& [document_id, relevance] : document_to_relevance) {
+        if (plan.has_probes) {
+            TraceProbes(plan, tracer);
+            if (IsExcludedByProbe(document_id, plan)) continue;
+        }
+        const DocumentData& document = documents_.at(document_id);
         matched_documents.push_back({
             document_id,
-            relevance,
-            documents_.at(document_id).rating
+            relevance / document.word_count,
+            document.rating
             });
     }
 
@@ -223,23 +942,29 @@ template<class ExecutionPolicy>
 std::tuple<std::vector<std::string_view>, DocumentStatus> SearchServer::MatchDocument(ExecutionPolicy&& policy, const std::string_view raw_query, int document_id) const {
     if (!IsValid(raw_query)) throw std::invalid_argument("Недопустимые знаки в запросе");
 
-    const Query query = ParseQuery(raw_query);
+    QueryArena arena;
+    const Query query = ParseQuery(raw_query, arena.Get());
     ValidParseWords(query);
     std::vector<std::string_view> matched_words;
+    std::mutex stop_insert_words;
 
     std::for_each(policy, query.plus_words.begin(), query.plus_words.end(),
-        [&](const std::string& word)mutable {
+        [&](const std::string_view word)mutable {
             if (this->IsContainWord(word) && this->IsContainWordId(word, document_id)) {
+                std::lock_guard guard_words(stop_insert_words);
                 matched_words.push_back(std::string_view{ *index_words_.at(document_id).find(word) });
             }
         });
 
+    MatchPrefixes(query, document_id, matched_words);
+
     for_each(policy, query.minus_words.begin(), query.minus_words.end(),
-        [&](const std::string& word) mutable {
+        [&](const std::string_view word) mutable {
             if (this->IsContainWord(word) && this->IsContainWordId(word, document_id)) {
+                std::lock_guard guard_words(stop_insert_words);
                 matched_words.clear();
             }
         });
 
     return { matched_words, documents_.at(document_id).status };
-}
\ No newline at end of file
+}
@@ -0,0 +1,20 @@
+#include "test_example_functions.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace std::string_literals;
+
+int main() {
+    try {
+        TestSearchServer();
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Search server tests OK"s << std::endl;
+    return 0;
+}
@@ -15,4 +15,18 @@ std::vector<std::string> SplitIntoWords(const std::string_view text) {
     words.push_back(word);
 
     return words;
-}
\ No newline at end of file
+}
+
+std::pmr::vector<std::string_view> SplitIntoWordsView(const std::string_view text, std::pmr::memory_resource* resource) {
+    std::pmr::vector<std::string_view> words(resource);
+    size_t begin = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == ' ') {
+            words.push_back(text.substr(begin, i - begin));
+            begin = i + 1;
+        }
+    }
+    words.push_back(text.substr(begin));
+
+    return words;
+}
@@ -3,5 +3,8 @@
 #include <vector>
 #include <string>
 #include <string_view>
+#include <memory_resource>
 
-std::vector<std::string> SplitIntoWords(const std::string_view text);
\ No newline at end of file
+std::vector<std::string> SplitIntoWords(const std::string_view text);
+
+std::pmr::vector<std::string_view> SplitIntoWordsView(const std::string_view text, std::pmr::memory_resource* resource);
\ No newline at end of file
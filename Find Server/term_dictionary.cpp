@@ -0,0 +1,70 @@
+#include "term_dictionary.h"
+#include "string_processing.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+using namespace std::string_literals;
+
+TermDictionary::TermDictionary(const std::string_view stop_words_text) {
+    if (std::any_of(stop_words_text.begin(), stop_words_text.end(), [](char c) { return c >= '\0' && c < ' '; })) {
+        throw std::invalid_argument("Недопустимые знаки"s);
+    }
+    for (const std::string& word : SplitIntoWords(stop_words_text)) {
+        stop_words_.insert(Intern(word));
+    }
+}
+
+std::string_view TermDictionary::Intern(const std::string_view word) {
+    {
+        std::shared_lock lock(mutex_);
+        const auto it = terms_.find(word);
+        if (it != terms_.end()) return *it;
+    }
+
+    std::unique_lock lock(mutex_);
+    const auto it = terms_.find(word);
+    if (it != terms_.end()) return *it;
+    return *terms_.insert(Store(word)).first;
+}
+
+size_t TermDictionary::GetTermCount() const {
+    std::shared_lock lock(mutex_);
+    return terms_.size();
+}
+
+size_t TermDictionary::GetBytes() const {
+    const size_t tree_node_overhead = 4 * sizeof(void*);
+    const size_t hash_node_bytes = sizeof(void*) + sizeof(std::string_view) + sizeof(size_t);
+
+    std::shared_lock lock(mutex_);
+    return chunk_bytes_
+        + chunks_.capacity() * sizeof(std::unique_ptr<char[]>)
+        + terms_.bucket_count() * sizeof(void*)
+        + terms_.size() * hash_node_bytes
+        + stop_words_.size() * (tree_node_overhead + sizeof(std::string_view));
+}
+
+std::string_view TermDictionary::Store(const std::string_view word) {
+    // Длинное слово получает отдельный блок; остаток текущего блока при этом теряется
+    if (word.size() > CHUNK_SIZE / 4) {
+        chunks_.push_back(std::make_unique<char[]>(word.size()));
+        chunk_bytes_ += word.size();
+        chunk_free_ = 0;
+        std::memcpy(chunks_.back().get(), word.data(), word.size());
+        return { chunks_.back().get(), word.size() };
+    }
+
+    if (chunks_.empty() || chunk_free_ < word.size()) {
+        chunks_.push_back(std::make_unique<char[]>(CHUNK_SIZE));
+        chunk_bytes_ += CHUNK_SIZE;
+        chunk_free_ = CHUNK_SIZE;
+    }
+    char* data = chunks_.back().get() + (CHUNK_SIZE - chunk_free_);
+    std::memcpy(data, word.data(), word.size());
+    chunk_free_ -= word.size();
+    return { data, word.size() };
+}
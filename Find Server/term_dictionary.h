@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <set>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// Общий словарь термов и стоп-слов для нескольких серверов (например, по одному на арендатора).
+// Строки только добавляются и никогда не перемещаются, поэтому серверы хранят в своих индексах
+// string_view на них, а постинги остаются у каждого сервера свои.
+// Intern потокобезопасен: серверы, подключенные к одному словарю, можно наполнять из разных потоков.
+class TermDictionary {
+public:
+    TermDictionary() = default;
+
+    // Стоп-слова задаются один раз и действуют во всех подключенных серверах
+    explicit TermDictionary(const std::string_view stop_words_text);
+
+    TermDictionary(const TermDictionary&) = delete;
+    TermDictionary& operator=(const TermDictionary&) = delete;
+
+    // Возвращает постоянное представление слова, добавляя его при первом обращении
+    std::string_view Intern(const std::string_view word);
+
+    inline bool IsStopWord(const std::string_view word) const {
+        return stop_words_.count(word) > 0;
+    }
+
+    inline const std::set<std::string_view, std::less<>>& GetStopWords() const noexcept {
+        return stop_words_;
+    }
+
+    size_t GetTermCount() const;
+
+    size_t GetBytes() const;
+
+private:
+    static constexpr size_t CHUNK_SIZE = 64 << 10;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_set<std::string_view> terms_;
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    size_t chunk_free_ = 0;
+    size_t chunk_bytes_ = 0;
+    std::set<std::string_view, std::less<>> stop_words_;
+
+    std::string_view Store(const std::string_view word);
+};
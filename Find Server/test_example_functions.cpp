@@ -1,6 +1,332 @@
 #include"test_example_functions.h"
+#include"index_builder.h"
+
+#include<algorithm>
+#include<cmath>
+#include<filesystem>
+#include<fstream>
+#include<stdexcept>
+#include<string>
+
+using namespace std::string_literals;
+
+namespace {
+
+	const std::vector<std::string>& GetExampleTexts() {
+		static const std::vector<std::string> texts = {
+			"white cat and fancy collar"s,
+			"fluffy cat fluffy tail"s,
+			"groomed dog expressive eyes"s,
+			"groomed starling evgeny"s,
+			"cat with big eyes"s,
+			"dog and cat"s,
+			"fancy dog collar"s,
+			"starling cat"s,
+			"cat cat cat dog"s,
+		};
+		return texts;
+	}
+
+	void AssertSameDocuments(const std::vector<Document>& expected, const std::vector<Document>& actual, const std::string& message) {
+		bool is_equal = expected.size() == actual.size();
+		for (size_t i = 0; is_equal && i < expected.size(); ++i) {
+			is_equal = expected[i].id == actual[i].id && std::abs(expected[i].relevance - actual[i].relevance) < RELEVANCE_EPSILON;
+		}
+		if (!is_equal) throw std::logic_error(message);
+	}
+
+	void AssertIds(const std::vector<Document>& documents, std::vector<int> expected, const std::string& message) {
+		std::vector<int> ids;
+		for (const Document& document : documents) {
+			ids.push_back(document.id);
+		}
+		std::sort(ids.begin(), ids.end());
+		std::sort(expected.begin(), expected.end());
+		if (ids != expected) throw std::logic_error(message);
+	}
+
+}
 
 void AddDocument(SearchServer& search_server,
 	int id, const std::string& words, DocumentStatus status, const std::vector<int>& ratings) {
 	search_server.AddDocument(id, words, status, ratings);
+}
+
+void TestRemoveDocumentKeepsRelevance() {
+	const std::vector<std::string>& texts = GetExampleTexts();
+	const int removed_id = static_cast<int>(texts.size()) - 1;
+
+	SearchServer removed("and with"s);
+	SearchServer rebuilt("and with"s);
+	for (int id = 0; id < static_cast<int>(texts.size()); ++id) {
+		AddDocument(removed, id, texts[id], DocumentStatus::ACTUAL, { id });
+		if (id != removed_id) {
+			AddDocument(rebuilt, id, texts[id], DocumentStatus::ACTUAL, { id });
+		}
+	}
+	removed.RemoveDocument(removed_id);
+	if (removed.GetTombstoneCount() == 0) throw std::logic_error("Документ снят без надгробия, проверка ничего не покрывает"s);
+
+	for (const AccumulatorMode mode : { AccumulatorMode::SPARSE, AccumulatorMode::DENSE }) {
+		removed.SetAccumulatorMode(mode);
+		rebuilt.SetAccumulatorMode(mode);
+		for (const std::string& query : { "cat"s, "cat dog"s, "fancy cat -collar"s, "groomed dog"s, "fl* ca*"s, "eyes -dog*"s }) {
+			AssertSameDocuments(rebuilt.FindTopDocuments(query), removed.FindTopDocuments(query),
+				"Выдача после RemoveDocument отличается от сервера без документа: "s + query);
+		}
+	}
+}
+
+void TestRemoveDocumentsMatchesRebuild() {
+	const std::vector<std::string>& texts = GetExampleTexts();
+	const std::vector<int> removed_ids = { 1, 5, 8 };
+
+	SearchServer removed("and with"s);
+	SearchServer rebuilt("and with"s);
+	for (int id = 0; id < static_cast<int>(texts.size()); ++id) {
+		AddDocument(removed, id, texts[id], DocumentStatus::ACTUAL, { id });
+		if (std::find(removed_ids.begin(), removed_ids.end(), id) == removed_ids.end()) {
+			AddDocument(rebuilt, id, texts[id], DocumentStatus::ACTUAL, { id });
+		}
+	}
+	removed.RemoveDocuments(removed_ids);
+	if (removed.GetDocumentCount() != rebuilt.GetDocumentCount()) throw std::logic_error("RemoveDocuments снял не все документы"s);
+
+	for (const std::string& query : { "cat"s, "cat dog"s, "fluffy"s, "ca* -collar"s }) {
+		AssertSameDocuments(rebuilt.FindTopDocuments(query), removed.FindTopDocuments(query),
+			"Выдача после RemoveDocuments отличается от сервера без документов: "s + query);
+	}
+}
+
+void TestPrefixQueries() {
+	SearchServer search_server("and with"s);
+	AddDocument(search_server, 0, "cat catalog dog"s, DocumentStatus::ACTUAL, { 1 });
+	AddDocument(search_server, 1, "category of goods"s, DocumentStatus::ACTUAL, { 2 });
+	AddDocument(search_server, 2, "dog walker"s, DocumentStatus::ACTUAL, { 3 });
+	AddDocument(search_server, 3, "cart"s, DocumentStatus::ACTUAL, { 4 });
+
+	AssertIds(search_server.FindTopDocuments("cat*"s), { 0, 1 }, "Префикс cat* нашел не те документы"s);
+	AssertIds(search_server.FindTopDocuments("ca*"s), { 0, 1, 3 }, "Префикс ca* нашел не те документы"s);
+	AssertIds(search_server.FindTopDocuments("dog -cat*"s), { 2 }, "Минус-префикс не исключил документ"s);
+	AssertIds(search_server.FindTopDocuments("zebra*"s), {}, "Префикс без термов нашел документы"s);
+
+	const auto [words, status] = search_server.MatchDocument("car*"s, 3);
+	if (words != std::vector<std::string_view>{ "cart" }) throw std::logic_error("MatchDocument не раскрыл префикс"s);
+}
+
+void TestOverlappingPrefixes() {
+	SearchServer search_server("and with"s);
+	AddDocument(search_server, 0, "cat catalog dog"s, DocumentStatus::ACTUAL, { 1 });
+	AddDocument(search_server, 1, "dog walker"s, DocumentStatus::ACTUAL, { 2 });
+	AddDocument(search_server, 2, "category cart"s, DocumentStatus::ACTUAL, { 3 });
+
+	for (const std::string& query : { "ca* cat*"s, "cat cat*"s, "cat* cat catalog"s }) {
+		const auto [words, status] = search_server.MatchDocument(query, 0);
+		if (words != std::vector<std::string_view>{ "cat", "catalog" }) throw std::logic_error("MatchDocument повторил слово: "s + query);
+		const auto [par_words, par_status] = search_server.MatchDocument(std::execution::par, query, 0);
+		if (par_words != words) throw std::logic_error("Параллельный MatchDocument отличается: "s + query);
+	}
+
+	// Терм, пришедший из плюс-слова и нескольких префиксов, учитывается в релевантности один раз
+	for (const AccumulatorMode mode : { AccumulatorMode::SPARSE, AccumulatorMode::DENSE }) {
+		search_server.SetAccumulatorMode(mode);
+		AssertSameDocuments(search_server.FindTopDocuments("cat*"s), search_server.FindTopDocuments("cat cat*"s), "Терм cat учтен дважды в cat cat*"s);
+		AssertSameDocuments(search_server.FindTopDocuments("ca*"s), search_server.FindTopDocuments("ca* cat*"s), "Термы cat* учтены дважды в ca* cat*"s);
+		AssertSameDocuments(search_server.FindTopDocuments("cat catalog category cart"s), search_server.FindTopDocuments("cat ca* cat*"s), "Раскрытие префиксов не совпало с перечислением термов"s);
+	}
+}
+
+void TestFuzzyLookup() {
+	SearchServer search_server("and with"s);
+	AddDocument(search_server, 0, "white cat"s, DocumentStatus::ACTUAL, { 1 });
+	AddDocument(search_server, 1, "fancy dog"s, DocumentStatus::ACTUAL, { 2 });
+
+	AssertIds(search_server.FindTopDocuments("cst"s), {}, "Без нечеткого поиска опечатка нашла документ"s);
+
+	search_server.EnableFuzzyLookup();
+	AssertIds(search_server.FindTopDocuments("cst"s), { 0 }, "Опечатка в одну правку не исправлена"s);
+	AssertIds(search_server.FindTopDocuments("cat -dgo"s), { 0 }, "Опечатка в минус-слове изменила выдачу"s);
+
+	search_server.DisableFuzzyLookup();
+	AssertIds(search_server.FindTopDocuments("cst"s), {}, "Нечеткий поиск не отключился"s);
+}
+
+void TestFuzzyDistanceBound() {
+	const auto is_live = [](const std::string&) { return true; };
+
+	FuzzyIndex near_index(FuzzySettings{ 1 });
+	near_index.AddWord("abcdef"s);
+	if (near_index.FindClosest("abcdeg"s, is_live) != std::vector<std::string>{ "abcdef"s }) throw std::logic_error("Слово на расстоянии 1 не найдено"s);
+	// Перестановка - две правки, хотя варианты удаления у слов общие
+	if (!near_index.FindClosest("abcdfe"s, is_live).empty()) throw std::logic_error("Найдено слово дальше max_distance = 1"s);
+
+	FuzzyIndex far_index(FuzzySettings{ 2 });
+	far_index.AddWord("abcdef"s);
+	if (far_index.FindClosest("abcdfe"s, is_live) != std::vector<std::string>{ "abcdef"s }) throw std::logic_error("Слово на расстоянии 2 не найдено"s);
+	if (!far_index.FindClosest("abdcfe"s, is_live).empty()) throw std::logic_error("Найдено слово дальше max_distance = 2"s);
+
+	SearchServer search_server("and with"s);
+	AddDocument(search_server, 0, "abcdef"s, DocumentStatus::ACTUAL, { 1 });
+	search_server.EnableFuzzyLookup();
+	AssertIds(search_server.FindTopDocuments("abcdfe"s), {}, "Запрос исправлен словом дальше max_distance"s);
+}
+
+void TestDenseMatchesSparse() {
+	const std::vector<std::string>& texts = GetExampleTexts();
+
+	SearchServer search_server("and with"s);
+	for (int id = 0; id < static_cast<int>(texts.size()); ++id) {
+		AddDocument(search_server, id, texts[id], static_cast<DocumentStatus>(id % DOCUMENT_STATUS_COUNT), { id });
+	}
+	search_server.RemoveDocument(4);
+
+	for (const std::string& query : { "cat"s, "cat dog -fancy"s, "fl* ca* -tail"s, "eyes -dog*"s, "starling groomed"s }) {
+		for (const DocumentFilter& filter : { DocumentFilter{}, DocumentFilter{ DocumentStatus::ACTUAL, DocumentStatus::BANNED } }) {
+			search_server.SetAccumulatorMode(AccumulatorMode::SPARSE);
+			const std::vector<Document> expected = search_server.FindTopDocuments(query, filter);
+			search_server.SetAccumulatorMode(AccumulatorMode::DENSE);
+			AssertSameDocuments(expected, search_server.FindTopDocuments(query, filter),
+				"Плотный накопитель дал другую выдачу: "s + query);
+		}
+	}
+}
+
+void TestLargeDocumentIds() {
+	SearchServer search_server("and with"s);
+	AddDocument(search_server, 1, "white cat"s, DocumentStatus::ACTUAL, { 1 });
+	AddDocument(search_server, 1500, "fluffy cat"s, DocumentStatus::ACTUAL, { 2 });
+	AddDocument(search_server, 100000000, "cat and dog"s, DocumentStatus::ACTUAL, { 3 });
+	AddDocument(search_server, 2000000000, "dog collar"s, DocumentStatus::ACTUAL, { 4 });
+	if (search_server.GetIndexStats().document_table_bytes > (1 << 20)) throw std::logic_error("Таблица документов растет с величиной id"s);
+
+	// Добавленные позже плотные id раздвигают массив слотов за id 1500, добавленный раньше
+	for (int id = 2; id < 800; ++id) {
+		AddDocument(search_server, id, "filler"s + std::to_string(id), DocumentStatus::ACTUAL, { id });
+	}
+	search_server.RemoveDocument(100000000);
+	AddDocument(search_server, 100000000, "cat cat"s, DocumentStatus::ACTUAL, { 5 });
+
+	for (const std::string& query : { "cat"s, "dog"s, "cat -collar"s, "fl* do*"s }) {
+		search_server.SetAccumulatorMode(AccumulatorMode::SPARSE);
+		const std::vector<Document> expected = search_server.FindTopDocuments(query);
+		search_server.SetAccumulatorMode(AccumulatorMode::DENSE);
+		AssertSameDocuments(expected, search_server.FindTopDocuments(query), "Плотный накопитель ошибся на больших id: "s + query);
+	}
+	AssertIds(search_server.FindTopDocuments("cat"s), { 1, 1500, 100000000 }, "Документы с большими id потерялись"s);
+}
+
+void TestDocumentFilter() {
+	const std::vector<std::string>& texts = GetExampleTexts();
+
+	SearchServer search_server("and with"s);
+	for (int id = 0; id < static_cast<int>(texts.size()); ++id) {
+		AddDocument(search_server, id, texts[id], static_cast<DocumentStatus>(id % DOCUMENT_STATUS_COUNT), { id });
+	}
+
+	const DocumentFilter filter = DocumentFilter{ DocumentStatus::ACTUAL, DocumentStatus::BANNED }.SetRatingRange(1, 8).SetIdRange(0, 7);
+	const auto predicate = [](int document_id, DocumentStatus status, int rating) {
+		return (status == DocumentStatus::ACTUAL || status == DocumentStatus::BANNED) && rating >= 1 && rating <= 8 && document_id <= 7;
+	};
+	for (const std::string& query : { "cat"s, "cat dog"s, "groomed -eyes"s, "fancy collar"s }) {
+		AssertSameDocuments(search_server.FindTopDocuments(query, predicate), search_server.FindTopDocuments(query, filter),
+			"DocumentFilter отбирает не те документы, что предикат: "s + query);
+	}
+}
+
+void TestImpactListsMatchFullRanking() {
+	SearchServer search_server("and with"s);
+	for (int id = 0; id < 40; ++id) {
+		std::string text = "cat"s;
+		for (int i = 0; i < id % 7; ++i) {
+			text += " filler"s + std::to_string(i);
+		}
+		AddDocument(search_server, id, text, DocumentStatus::ACTUAL, { id % 5 });
+	}
+
+	search_server.DisableImpactLists();
+	const std::vector<Document> expected = search_server.FindTopDocuments("cat"s);
+	search_server.EnableImpactLists(1);
+	AssertSameDocuments(expected, search_server.FindTopDocuments("cat"s), "Ответ по списку импактов отличается от полного ранжирования"s);
+}
+
+void TestPostingsAcrossStatusesAndColdStorage() {
+	const std::vector<std::string>& texts = GetExampleTexts();
+	const std::vector<int> removed_ids = { 2, 7 };
+	const std::vector<std::string> queries = { "cat"s, "cat dog"s, "groomed -eyes"s, "st* ca*"s };
+
+	SearchServer search_server("and with"s);
+	SearchServer rebuilt("and with"s);
+	for (int id = 0; id < static_cast<int>(texts.size()); ++id) {
+		const DocumentStatus status = static_cast<DocumentStatus>(id % DOCUMENT_STATUS_COUNT);
+		AddDocument(search_server, id, texts[id], status, { id });
+		if (std::find(removed_ids.begin(), removed_ids.end(), id) == removed_ids.end()) {
+			AddDocument(rebuilt, id, texts[id], status, { id });
+		}
+	}
+
+	const SearchServer copy = search_server;
+	ColdStorageSettings settings;
+	settings.path = (std::filesystem::temp_directory_path() / "search_server_tests.cold"s).string();
+	settings.min_posting_count = 1;
+	search_server.EnableColdStorage(settings);
+	for (const std::string& query : queries) {
+		AssertSameDocuments(copy.FindTopDocuments(query, DocumentFilter{}), search_server.FindTopDocuments(query, DocumentFilter{}),
+			"Выдача из холодных списков отличается: "s + query);
+	}
+
+	search_server.RemoveDocuments(removed_ids);
+	search_server.DisableColdStorage();
+	std::filesystem::remove(settings.path);
+	for (const std::string& query : queries) {
+		AssertSameDocuments(rebuilt.FindTopDocuments(query, DocumentFilter{}), search_server.FindTopDocuments(query, DocumentFilter{}),
+			"Выдача после удаления из холодных списков отличается: "s + query);
+	}
+}
+
+void TestIndexBuilder() {
+	const std::filesystem::path dump_path = std::filesystem::temp_directory_path() / "search_server_tests.dump"s;
+	const std::filesystem::path snapshot_path = std::filesystem::temp_directory_path() / "search_server_tests.snapshot"s;
+	const auto write_dump = [&dump_path](const std::vector<int>& ids) {
+		std::ofstream dump(dump_path);
+		for (const int id : ids) {
+			dump << id << '\t' << 0 << '\t' << id << '\t' << GetExampleTexts()[id % GetExampleTexts().size()] << '\n';
+		}
+	};
+
+	write_dump({ 0, 1, 2, 3 });
+	BuildIndexSnapshot(dump_path.string(), snapshot_path.string(), "and with"s);
+	SearchServer loaded("and with"s);
+	loaded.LoadSnapshot(snapshot_path.string());
+	SearchServer added("and with"s);
+	for (int id = 0; id < 4; ++id) {
+		AddDocument(added, id, GetExampleTexts()[id], DocumentStatus::ACTUAL, { id });
+	}
+	AssertSameDocuments(added.FindTopDocuments("fluffy cat"s), loaded.FindTopDocuments("fluffy cat"s), "Снимок из дампа дает другую выдачу"s);
+
+	write_dump({ 0, 1, 2, 1 });
+	bool is_rejected = false;
+	try {
+		BuildIndexSnapshot(dump_path.string(), snapshot_path.string(), "and with"s);
+	}
+	catch (const std::invalid_argument&) {
+		is_rejected = true;
+	}
+	std::filesystem::remove(dump_path);
+	std::filesystem::remove(snapshot_path);
+	if (!is_rejected) throw std::logic_error("Дамп с повтором id построен без ошибки"s);
+}
+
+void TestSearchServer() {
+	TestRemoveDocumentKeepsRelevance();
+	TestRemoveDocumentsMatchesRebuild();
+	TestPrefixQueries();
+	TestOverlappingPrefixes();
+	TestFuzzyLookup();
+	TestFuzzyDistanceBound();
+	TestDenseMatchesSparse();
+	TestLargeDocumentIds();
+	TestDocumentFilter();
+	TestImpactListsMatchFullRanking();
+	TestPostingsAcrossStatusesAndColdStorage();
+	TestIndexBuilder();
 }
\ No newline at end of file
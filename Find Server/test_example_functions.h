@@ -5,4 +5,40 @@
 
 #include<vector>
 
-void AddDocument(SearchServer& search_server, int id, const std::string& words, DocumentStatus status, const std::vector<int>& ratings);
\ No newline at end of file
+void AddDocument(SearchServer& search_server, int id, const std::string& words, DocumentStatus status, const std::vector<int>& ratings);
+
+// Удаление документа до уплотнения индекса должно давать ту же выдачу и релевантность,
+// что и сервер, в который документ не добавлялся. При расхождении бросает logic_error.
+void TestRemoveDocumentKeepsRelevance();
+
+void TestRemoveDocumentsMatchesRebuild();
+
+void TestPrefixQueries();
+
+// Слово из плюс-слова и нескольких префиксов выдается и учитывается в релевантности один раз
+void TestOverlappingPrefixes();
+
+void TestFuzzyLookup();
+
+// Слово на расстоянии max_distance + 1 не должно находиться никогда
+void TestFuzzyDistanceBound();
+
+// Плотный и разреженный накопители должны давать одинаковую выдачу
+void TestDenseMatchesSparse();
+
+// Слоты документов с редкими большими id не должны раздувать память
+void TestLargeDocumentIds();
+
+// DocumentFilter должен отбирать те же документы, что и равносильный предикат
+void TestDocumentFilter();
+
+void TestImpactListsMatchFullRanking();
+
+// Копия сервера, вынос списков на диск и удаление из них не меняют выдачу ни в одном статусе
+void TestPostingsAcrossStatusesAndColdStorage();
+
+// Снимок из дампа загружается с той же выдачей, дамп с повтором id отвергается
+void TestIndexBuilder();
+
+// Запускает все проверки выше, первая неудачная бросает logic_error
+void TestSearchServer();
\ No newline at end of file
@@ -0,0 +1,550 @@
+#pragma once
+
+#include "graph.h"
+#include "router.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+    // Иерархия сжатия (contraction hierarchies). Вершины по очереди исключаются из графа в порядке ранга,
+    // а кратчайшие пути через исключенную вершину сохраняются ребрами-сокращениями между ее соседями.
+    // Ребра иерархии нумеруются подряд: сначала ребра графа, затем сокращения (id - число ребер графа);
+    // first и second - ребра иерархии from -> середина -> to, которые заменяет сокращение.
+    template <typename Weight>
+    struct ContractionHierarchy {
+        struct Shortcut {
+            VertexId from;
+            VertexId to;
+            Weight weight;
+            EdgeId first;
+            EdgeId second;
+        };
+
+        std::vector<uint32_t> ranks;
+        std::vector<Shortcut> shortcuts;
+    };
+
+    // Строит иерархию: порядок вершин - по числу добавляемых сокращений за вычетом убираемых ребер,
+    // числу уже сжатых соседей и глубине в иерархии, с ленивым пересчетом приоритета.
+    // Поиск свидетеля (пути в обход сжимаемой вершины) ограничен witness_settle_limit вершинами;
+    // если его не хватило, сокращение добавляется на всякий случай.
+    template <typename Weight>
+    class ContractionHierarchyBuilder {
+    private:
+        using Graph = DirectedWeightedGraph<Weight>;
+
+    public:
+        explicit ContractionHierarchyBuilder(const Graph& graph, size_t witness_settle_limit = 128);
+
+        ContractionHierarchy<Weight> Build();
+
+    private:
+        struct Arc {
+            VertexId vertex;
+            Weight weight;
+            EdgeId edge;
+        };
+
+        const Graph& graph_;
+        const size_t witness_settle_limit_;
+        ContractionHierarchy<Weight> hierarchy_;
+
+        // Рабочий граф из еще не сжатых вершин; из параллельных ребер остается самое легкое
+        std::vector<std::vector<Arc>> out_arcs_;
+        std::vector<std::vector<Arc>> in_arcs_;
+        std::vector<int> contracted_neighbors_;
+        std::vector<int> levels_;
+
+        std::vector<Weight> witness_weights_;
+        std::vector<bool> witness_reached_;
+        std::vector<bool> witness_targets_;
+        std::vector<VertexId> witness_touched_;
+        std::vector<std::pair<Weight, VertexId>> witness_heap_;
+
+        bool AddArc(VertexId from, VertexId to, Weight weight, EdgeId edge);
+
+        void RemoveArcs(std::vector<Arc>& arcs, VertexId vertex);
+
+        // Останавливается, когда пройдены все target_count соседей, отмеченных в witness_targets_
+        void FindWitnesses(VertexId source, VertexId excluded, Weight max_weight, size_t target_count);
+
+        void ResetWitnesses();
+
+        // Возвращает число сокращений, которые нужны для сжатия вершины; с apply они добавляются
+        size_t ContractVertex(VertexId vertex, bool apply);
+
+        int ComputePriority(VertexId vertex);
+    };
+
+    template <typename Weight>
+    ContractionHierarchy<Weight> BuildContractionHierarchy(const DirectedWeightedGraph<Weight>& graph) {
+        return ContractionHierarchyBuilder<Weight>(graph).Build();
+    }
+
+    // Двунаправленный поиск по иерархии: из начала - только по ребрам вверх по рангу,
+    // из конца - назад только по ребрам, приходящим сверху. Пути встречаются в вершине наибольшего ранга.
+    // Рабочие массивы потока переиспользуются между запросами, как у DijkstraRouter.
+    template <typename Weight>
+    class HierarchyRouter {
+    private:
+        using Graph = DirectedWeightedGraph<Weight>;
+
+    public:
+        HierarchyRouter(const Graph& graph, const ContractionHierarchy<Weight>& hierarchy);
+
+        using RouteInfo = typename Router<Weight>::RouteInfo;
+
+        // Сокращения в ответе раскрыты до ребер графа
+        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+
+    private:
+        struct Arc {
+            VertexId vertex;
+            Weight weight;
+            EdgeId edge;
+        };
+
+        // Ребра каждой вершины подряд в одном массиве, offsets[v] - начало списка вершины v
+        struct SearchGraph {
+            std::vector<size_t> offsets;
+            std::vector<Arc> arcs;
+        };
+
+        struct DirectionState {
+            std::vector<Weight> weights;
+            std::vector<EdgeId> prev_edges;
+            std::vector<bool> reached;
+            std::vector<VertexId> touched;
+            std::vector<std::pair<Weight, VertexId>> heap;
+
+            void Reset(size_t vertex_count) {
+                for (const VertexId vertex : touched) {
+                    reached[vertex] = false;
+                }
+                touched.clear();
+                heap.clear();
+                if (reached.size() < vertex_count) {
+                    weights.resize(vertex_count);
+                    prev_edges.resize(vertex_count);
+                    reached.resize(vertex_count, false);
+                }
+            }
+        };
+
+        static std::pair<DirectionState, DirectionState>& GetSearchState() {
+            thread_local std::pair<DirectionState, DirectionState> state;
+            return state;
+        }
+
+        const Graph& graph_;
+        const ContractionHierarchy<Weight>& hierarchy_;
+        SearchGraph upward_;
+        SearchGraph downward_;
+
+        Edge<Weight> GetHierarchyEdge(EdgeId edge_id) const;
+
+        void AppendUnpacked(EdgeId edge_id, std::vector<EdgeId>& edges) const;
+    };
+
+    template <typename Weight>
+    ContractionHierarchyBuilder<Weight>::ContractionHierarchyBuilder(const Graph& graph, size_t witness_settle_limit)
+        : graph_(graph)
+        , witness_settle_limit_(witness_settle_limit)
+    {
+        const size_t vertex_count = graph.GetVertexCount();
+        out_arcs_.resize(vertex_count);
+        in_arcs_.resize(vertex_count);
+        contracted_neighbors_.assign(vertex_count, 0);
+        levels_.assign(vertex_count, 0);
+        witness_weights_.resize(vertex_count);
+        witness_reached_.assign(vertex_count, false);
+        witness_targets_.assign(vertex_count, false);
+
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+            const auto edge = graph.GetEdge(edge_id);
+            if (edge.weight < Weight{}) {
+                throw std::domain_error("Edges' weights should be non-negative");
+            }
+            // Петля не бывает частью кратчайшего пути
+            if (edge.from != edge.to) {
+                AddArc(edge.from, edge.to, edge.weight, edge_id);
+            }
+        }
+    }
+
+    template <typename Weight>
+    ContractionHierarchy<Weight> ContractionHierarchyBuilder<Weight>::Build() {
+        const size_t vertex_count = graph_.GetVertexCount();
+        hierarchy_.ranks.assign(vertex_count, 0);
+
+        using QueueItem = std::pair<int, VertexId>;
+        std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+            queue.emplace(ComputePriority(vertex), vertex);
+        }
+
+        uint32_t next_rank = 0;
+        while (!queue.empty()) {
+            const VertexId vertex = queue.top().second;
+            queue.pop();
+
+            // Приоритет мог вырасти после сжатия соседей; тогда вершина возвращается в очередь
+            const int priority = ComputePriority(vertex);
+            if (!queue.empty() && priority > queue.top().first) {
+                queue.emplace(priority, vertex);
+                continue;
+            }
+
+            ContractVertex(vertex, true);
+            hierarchy_.ranks[vertex] = next_rank++;
+
+            for (const Arc& arc : in_arcs_[vertex]) {
+                RemoveArcs(out_arcs_[arc.vertex], vertex);
+                ++contracted_neighbors_[arc.vertex];
+                levels_[arc.vertex] = std::max(levels_[arc.vertex], levels_[vertex] + 1);
+            }
+            for (const Arc& arc : out_arcs_[vertex]) {
+                RemoveArcs(in_arcs_[arc.vertex], vertex);
+                ++contracted_neighbors_[arc.vertex];
+                levels_[arc.vertex] = std::max(levels_[arc.vertex], levels_[vertex] + 1);
+            }
+            std::vector<Arc>().swap(in_arcs_[vertex]);
+            std::vector<Arc>().swap(out_arcs_[vertex]);
+        }
+
+        return std::move(hierarchy_);
+    }
+
+    template <typename Weight>
+    bool ContractionHierarchyBuilder<Weight>::AddArc(VertexId from, VertexId to, Weight weight, EdgeId edge) {
+        auto& out_arcs = out_arcs_[from];
+        const auto it = std::find_if(out_arcs.begin(), out_arcs.end(), [to](const Arc& arc) { return arc.vertex == to; });
+        if (it == out_arcs.end()) {
+            out_arcs.push_back({ to, weight, edge });
+            in_arcs_[to].push_back({ from, weight, edge });
+            return true;
+        }
+        if (!(weight < it->weight)) {
+            return false;
+        }
+
+        *it = { to, weight, edge };
+        for (Arc& arc : in_arcs_[to]) {
+            if (arc.vertex == from) {
+                arc = { from, weight, edge };
+                break;
+            }
+        }
+        return true;
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyBuilder<Weight>::RemoveArcs(std::vector<Arc>& arcs, VertexId vertex) {
+        arcs.erase(std::remove_if(arcs.begin(), arcs.end(), [vertex](const Arc& arc) { return arc.vertex == vertex; }),
+            arcs.end());
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyBuilder<Weight>::ResetWitnesses() {
+        for (const VertexId vertex : witness_touched_) {
+            witness_reached_[vertex] = false;
+        }
+        witness_touched_.clear();
+        witness_heap_.clear();
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyBuilder<Weight>::FindWitnesses(VertexId source, VertexId excluded, Weight max_weight,
+        size_t target_count) {
+        ResetWitnesses();
+        const auto heap_order = std::greater<std::pair<Weight, VertexId>>();
+
+        witness_weights_[source] = Weight{};
+        witness_reached_[source] = true;
+        witness_touched_.push_back(source);
+        witness_heap_.emplace_back(Weight{}, source);
+
+        size_t settled_count = 0;
+        while (!witness_heap_.empty() && settled_count < witness_settle_limit_) {
+            std::pop_heap(witness_heap_.begin(), witness_heap_.end(), heap_order);
+            const auto [weight, vertex] = witness_heap_.back();
+            witness_heap_.pop_back();
+            if (witness_weights_[vertex] < weight) {
+                continue;
+            }
+            if (max_weight < weight) {
+                break;
+            }
+            ++settled_count;
+            if (witness_targets_[vertex] && --target_count == 0) {
+                break;
+            }
+
+            for (const Arc& arc : out_arcs_[vertex]) {
+                if (arc.vertex == excluded) {
+                    continue;
+                }
+                const Weight candidate_weight = weight + arc.weight;
+                if (witness_reached_[arc.vertex] && !(candidate_weight < witness_weights_[arc.vertex])) {
+                    continue;
+                }
+                if (!witness_reached_[arc.vertex]) {
+                    witness_reached_[arc.vertex] = true;
+                    witness_touched_.push_back(arc.vertex);
+                }
+                witness_weights_[arc.vertex] = candidate_weight;
+                witness_heap_.emplace_back(candidate_weight, arc.vertex);
+                std::push_heap(witness_heap_.begin(), witness_heap_.end(), heap_order);
+            }
+        }
+    }
+
+    template <typename Weight>
+    size_t ContractionHierarchyBuilder<Weight>::ContractVertex(VertexId vertex, bool apply) {
+        size_t shortcut_count = 0;
+
+        // Свидетель возможен только для соседа, в который входят ребра не только из сжимаемой вершины
+        size_t target_count = 0;
+        for (const Arc& out_arc : out_arcs_[vertex]) {
+            if (in_arcs_[out_arc.vertex].size() > 1) {
+                witness_targets_[out_arc.vertex] = true;
+                ++target_count;
+            }
+        }
+
+        // Списки самой вершины при добавлении сокращений не меняются: петель в рабочем графе нет
+        for (const Arc& in_arc : in_arcs_[vertex]) {
+            std::optional<Weight> max_weight;
+            for (const Arc& out_arc : out_arcs_[vertex]) {
+                if (out_arc.vertex != in_arc.vertex && (!max_weight || *max_weight < in_arc.weight + out_arc.weight)) {
+                    max_weight = in_arc.weight + out_arc.weight;
+                }
+            }
+            if (!max_weight) {
+                continue;
+            }
+
+            if (target_count > (witness_targets_[in_arc.vertex] ? 1u : 0u)) {
+                FindWitnesses(in_arc.vertex, vertex, *max_weight, target_count);
+            }
+            else {
+                ResetWitnesses();
+            }
+
+            for (const Arc& out_arc : out_arcs_[vertex]) {
+                const Weight weight = in_arc.weight + out_arc.weight;
+                if (out_arc.vertex == in_arc.vertex
+                    || (witness_reached_[out_arc.vertex] && !(weight < witness_weights_[out_arc.vertex]))) {
+                    continue;
+                }
+                ++shortcut_count;
+                if (apply && AddArc(in_arc.vertex, out_arc.vertex, weight, graph_.GetEdgeCount() + hierarchy_.shortcuts.size())) {
+                    hierarchy_.shortcuts.push_back({ in_arc.vertex, out_arc.vertex, weight, in_arc.edge, out_arc.edge });
+                }
+            }
+        }
+
+        for (const Arc& out_arc : out_arcs_[vertex]) {
+            witness_targets_[out_arc.vertex] = false;
+        }
+
+        return shortcut_count;
+    }
+
+    template <typename Weight>
+    int ContractionHierarchyBuilder<Weight>::ComputePriority(VertexId vertex) {
+        const size_t shortcut_count = ContractVertex(vertex, false);
+        return static_cast<int>(shortcut_count) - static_cast<int>(in_arcs_[vertex].size() + out_arcs_[vertex].size())
+            + contracted_neighbors_[vertex] + levels_[vertex];
+    }
+
+    template <typename Weight>
+    HierarchyRouter<Weight>::HierarchyRouter(const Graph& graph, const ContractionHierarchy<Weight>& hierarchy)
+        : graph_(graph)
+        , hierarchy_(hierarchy)
+    {
+        const size_t vertex_count = graph.GetVertexCount();
+        const size_t edge_count = graph.GetEdgeCount();
+        if (hierarchy.ranks.size() != vertex_count) {
+            throw std::invalid_argument("Contraction hierarchy does not match the graph");
+        }
+        std::vector<bool> rank_used(vertex_count, false);
+        for (const uint32_t rank : hierarchy.ranks) {
+            if (rank >= vertex_count || rank_used[rank]) {
+                throw std::invalid_argument("Contraction hierarchy ranks are not a vertex order");
+            }
+            rank_used[rank] = true;
+        }
+        // Сокращение ссылается только на более ранние ребра иерархии, поэтому раскрытие конечно
+        for (size_t i = 0; i < hierarchy.shortcuts.size(); ++i) {
+            const auto& shortcut = hierarchy.shortcuts[i];
+            if (shortcut.from >= vertex_count || shortcut.to >= vertex_count
+                || shortcut.first >= edge_count + i || shortcut.second >= edge_count + i) {
+                throw std::invalid_argument("Contraction hierarchy refers to a missing edge");
+            }
+        }
+
+        upward_.offsets.assign(vertex_count + 1, 0);
+        downward_.offsets.assign(vertex_count + 1, 0);
+        const size_t hierarchy_edge_count = edge_count + hierarchy.shortcuts.size();
+        auto for_each_hierarchy_edge = [&](auto function) {
+            for (EdgeId edge_id = 0; edge_id < hierarchy_edge_count; ++edge_id) {
+                const Edge<Weight> edge = GetHierarchyEdge(edge_id);
+                if (edge.weight < Weight{}) {
+                    throw std::domain_error("Edges' weights should be non-negative");
+                }
+                if (edge.from != edge.to) {
+                    function(edge_id, edge);
+                }
+            }
+        };
+
+        for_each_hierarchy_edge([&](EdgeId, const Edge<Weight>& edge) {
+            if (hierarchy.ranks[edge.from] < hierarchy.ranks[edge.to]) {
+                ++upward_.offsets[edge.from + 1];
+            }
+            else {
+                ++downward_.offsets[edge.to + 1];
+            }
+        });
+        for (size_t vertex = 0; vertex < vertex_count; ++vertex) {
+            upward_.offsets[vertex + 1] += upward_.offsets[vertex];
+            downward_.offsets[vertex + 1] += downward_.offsets[vertex];
+        }
+
+        upward_.arcs.resize(upward_.offsets.back());
+        downward_.arcs.resize(downward_.offsets.back());
+        std::vector<size_t> upward_next(upward_.offsets.begin(), upward_.offsets.end() - 1);
+        std::vector<size_t> downward_next(downward_.offsets.begin(), downward_.offsets.end() - 1);
+        for_each_hierarchy_edge([&](EdgeId edge_id, const Edge<Weight>& edge) {
+            if (hierarchy.ranks[edge.from] < hierarchy.ranks[edge.to]) {
+                upward_.arcs[upward_next[edge.from]++] = { edge.to, edge.weight, edge_id };
+            }
+            else {
+                downward_.arcs[downward_next[edge.to]++] = { edge.from, edge.weight, edge_id };
+            }
+        });
+    }
+
+    template <typename Weight>
+    Edge<Weight> HierarchyRouter<Weight>::GetHierarchyEdge(EdgeId edge_id) const {
+        if (edge_id < graph_.GetEdgeCount()) {
+            return graph_.GetEdge(edge_id);
+        }
+        const auto& shortcut = hierarchy_.shortcuts[edge_id - graph_.GetEdgeCount()];
+        return { shortcut.from, shortcut.to, shortcut.weight };
+    }
+
+    template <typename Weight>
+    void HierarchyRouter<Weight>::AppendUnpacked(EdgeId edge_id, std::vector<EdgeId>& edges) const {
+        std::vector<EdgeId> stack{ edge_id };
+        while (!stack.empty()) {
+            const EdgeId current = stack.back();
+            stack.pop_back();
+            if (current < graph_.GetEdgeCount()) {
+                edges.push_back(current);
+                continue;
+            }
+            const auto& shortcut = hierarchy_.shortcuts[current - graph_.GetEdgeCount()];
+            stack.push_back(shortcut.second);
+            stack.push_back(shortcut.first);
+        }
+    }
+
+    template <typename Weight>
+    std::optional<typename HierarchyRouter<Weight>::RouteInfo> HierarchyRouter<Weight>::BuildRoute(VertexId from,
+        VertexId to) const {
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (from >= vertex_count || to >= vertex_count) {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+
+        auto& [forward, backward] = GetSearchState();
+        forward.Reset(vertex_count);
+        backward.Reset(vertex_count);
+        const auto heap_order = std::greater<std::pair<Weight, VertexId>>();
+
+        for (auto [state, vertex] : { std::pair{ &forward, from }, std::pair{ &backward, to } }) {
+            state->weights[vertex] = Weight{};
+            state->reached[vertex] = true;
+            state->touched.push_back(vertex);
+            state->heap.emplace_back(Weight{}, vertex);
+        }
+
+        std::optional<Weight> best_weight;
+        VertexId meeting_vertex = from;
+
+        // Каждое направление останавливается, когда ближайшая вершина в его куче не легче лучшего пути
+        while (!forward.heap.empty() || !backward.heap.empty()) {
+            const bool is_forward = backward.heap.empty()
+                || (!forward.heap.empty() && !(backward.heap.front().first < forward.heap.front().first));
+            DirectionState& state = is_forward ? forward : backward;
+            const DirectionState& other = is_forward ? backward : forward;
+            const SearchGraph& search_graph = is_forward ? upward_ : downward_;
+
+            if (best_weight && !(state.heap.front().first < *best_weight)) {
+                state.heap.clear();
+                continue;
+            }
+
+            std::pop_heap(state.heap.begin(), state.heap.end(), heap_order);
+            const auto [weight, vertex] = state.heap.back();
+            state.heap.pop_back();
+            if (state.weights[vertex] < weight) {
+                continue;
+            }
+
+            if (other.reached[vertex] && (!best_weight || weight + other.weights[vertex] < *best_weight)) {
+                best_weight = weight + other.weights[vertex];
+                meeting_vertex = vertex;
+            }
+
+            for (size_t i = search_graph.offsets[vertex]; i < search_graph.offsets[vertex + 1]; ++i) {
+                const Arc& arc = search_graph.arcs[i];
+                const Weight candidate_weight = weight + arc.weight;
+                if (state.reached[arc.vertex] && !(candidate_weight < state.weights[arc.vertex])) {
+                    continue;
+                }
+                if (!state.reached[arc.vertex]) {
+                    state.reached[arc.vertex] = true;
+                    state.touched.push_back(arc.vertex);
+                }
+                state.weights[arc.vertex] = candidate_weight;
+                state.prev_edges[arc.vertex] = arc.edge;
+                state.heap.emplace_back(candidate_weight, arc.vertex);
+                std::push_heap(state.heap.begin(), state.heap.end(), heap_order);
+            }
+        }
+
+        if (!best_weight) {
+            return std::nullopt;
+        }
+
+        std::vector<EdgeId> forward_edges;
+        for (VertexId vertex = meeting_vertex; vertex != from;) {
+            forward_edges.push_back(forward.prev_edges[vertex]);
+            vertex = GetHierarchyEdge(forward_edges.back()).from;
+        }
+
+        std::vector<EdgeId> edges;
+        for (auto it = forward_edges.rbegin(); it != forward_edges.rend(); ++it) {
+            AppendUnpacked(*it, edges);
+        }
+        for (VertexId vertex = meeting_vertex; vertex != to;) {
+            const EdgeId edge_id = backward.prev_edges[vertex];
+            AppendUnpacked(edge_id, edges);
+            vertex = GetHierarchyEdge(edge_id).to;
+        }
+
+        return RouteInfo{ *best_weight, std::move(edges) };
+    }
+
+}  // namespace graph
@@ -10,6 +10,11 @@ using namespace transport_catalogue;
 struct RoutingSettings {
 	double bus_velocity;
 	int bus_wait_time;
+	// make_base заранее считает маршруты между всеми парами остановок и сохраняет их в базу
+	bool precompute_routes = false;
+	// make_base строит иерархию сжатия графа, маршруты ищутся по ней двунаправленным поиском.
+	// Вместе с precompute_routes не действует: в базу попадает только таблица
+	bool contraction_hierarchy = false;
 };
 
 struct InformationForCatalog {
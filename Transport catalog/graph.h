@@ -2,7 +2,10 @@
 
 #include "ranges.h"
 
+#include <cstdint>
 #include <cstdlib>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 
 namespace graph {
@@ -17,100 +20,177 @@ namespace graph {
         Weight weight;
     };
 
+    // Ребра хранятся по полям в отдельных массивах с 32-битными id. Пока граф строится,
+    // у каждой вершины свой список исходящих ребер; Freeze один раз укладывает их в CSR:
+    // ребра вершины v занимают позиции [offsets[v], offsets[v + 1]) в общих массивах id, концов и весов,
+    // а для id ребра запоминается его позиция. После Freeze граф только читается,
+    // а поиск маршрутов обходит смежность подряд по памяти.
     template <typename Weight>
     class DirectedWeightedGraph {
     private:
-        using IncidenceList = std::vector<EdgeId>;
-        using IncidentEdgesRange = ranges::Range<typename IncidenceList::const_iterator>;
+        using IncidenceList = std::vector<uint32_t>;
+        using IncidentEdgesRange = ranges::Range<const uint32_t*>;
 
     public:
-        DirectedWeightedGraph() = default;
-
-        DirectedWeightedGraph(std::vector<Edge<Weight>>&& edges,
-            std::vector<IncidenceList>&& incidence_lists)
-            : edges_(std::move(edges)),
-            incidence_lists_(std::move(incidence_lists)){}
+        // Исходящие ребра вершины замороженного графа
+        struct IncidentArcs {
+            const uint32_t* edge_ids;
+            const uint32_t* targets;
+            const Weight* weights;
+            size_t size;
+        };
 
+        DirectedWeightedGraph() = default;
 
         explicit DirectedWeightedGraph(size_t vertex_count);
         EdgeId AddEdge(const Edge<Weight>& edge);
         void Resize(size_t new_size);
 
+        void Freeze();
+        bool IsFrozen() const;
+
         size_t GetVertexCount() const;
         size_t GetEdgeCount() const;
-        const Edge<Weight>& GetEdge(EdgeId edge_id) const;
+        Edge<Weight> GetEdge(EdgeId edge_id) const;
         IncidentEdgesRange GetIncidentEdges(VertexId vertex) const;
-   
-        const std::vector<Edge<Weight>>& GetVectorEdges() const;      
-        const std::vector<IncidenceList>& GetList() const;
-        void SetList(std::vector<std::vector<EdgeId>>&&);        
-        void SetVectorEdges(std::vector<Edge<Weight>>&& other);
-        
-    
+
+        // Только для замороженного графа
+        IncidentArcs GetIncidentArcs(VertexId vertex) const;
+
     private:
-        std::vector<Edge<Weight>> edges_;
+        size_t vertex_count_ = 0;
+        bool frozen_ = false;
+
+        std::vector<uint32_t> edge_from_;
+
+        // Пока граф строится
+        std::vector<uint32_t> edge_to_;
+        std::vector<Weight> edge_weights_;
         std::vector<IncidenceList> incidence_lists_;
+
+        // После Freeze
+        std::vector<uint32_t> edge_positions_;
+        std::vector<uint32_t> offsets_;
+        std::vector<uint32_t> arc_edge_ids_;
+        std::vector<uint32_t> arc_targets_;
+        std::vector<Weight> arc_weights_;
     };
 
     template <typename Weight>
     DirectedWeightedGraph<Weight>::DirectedWeightedGraph(size_t vertex_count)
-        : incidence_lists_(vertex_count) {
+        : vertex_count_(vertex_count)
+        , incidence_lists_(vertex_count) {
+        if (vertex_count >= std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("Too many vertices for a graph");
+        }
     }
 
     template <typename Weight>
     void DirectedWeightedGraph<Weight>::Resize(size_t new_size) {
-        //edges_.resize(new_size);
+        if (frozen_) {
+            throw std::logic_error("Frozen graph can't be changed");
+        }
+        if (new_size >= std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("Too many vertices for a graph");
+        }
+        vertex_count_ = new_size;
         incidence_lists_.resize(new_size);
     }
 
     template <typename Weight>
     EdgeId DirectedWeightedGraph<Weight>::AddEdge(const Edge<Weight>& edge) {
-        edges_.push_back(edge);
-        const EdgeId id = edges_.size() - 1;
-        incidence_lists_.at(edge.from).push_back(id);
+        if (frozen_) {
+            throw std::logic_error("Frozen graph can't be changed");
+        }
+        if (edge.from >= vertex_count_ || edge.to >= vertex_count_) {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+        if (edge_from_.size() >= std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("Too many edges for a graph");
+        }
+
+        const EdgeId id = edge_from_.size();
+        edge_from_.push_back(static_cast<uint32_t>(edge.from));
+        edge_to_.push_back(static_cast<uint32_t>(edge.to));
+        edge_weights_.push_back(edge.weight);
+        incidence_lists_[edge.from].push_back(static_cast<uint32_t>(id));
         return id;
     }
 
     template <typename Weight>
-    size_t DirectedWeightedGraph<Weight>::GetVertexCount() const {
-        return incidence_lists_.size();
-    }
-
-    template <typename Weight>
-    size_t DirectedWeightedGraph<Weight>::GetEdgeCount() const {
-        return edges_.size();
+    void DirectedWeightedGraph<Weight>::Freeze() {
+        if (frozen_) {
+            return;
+        }
+
+        offsets_.assign(vertex_count_ + 1, 0);
+        for (VertexId vertex = 0; vertex < vertex_count_; ++vertex) {
+            offsets_[vertex + 1] = offsets_[vertex] + static_cast<uint32_t>(incidence_lists_[vertex].size());
+        }
+
+        const size_t edge_count = edge_from_.size();
+        edge_positions_.resize(edge_count);
+        arc_edge_ids_.reserve(edge_count);
+        arc_targets_.reserve(edge_count);
+        arc_weights_.reserve(edge_count);
+        for (const IncidenceList& list : incidence_lists_) {
+            for (const uint32_t edge_id : list) {
+                edge_positions_[edge_id] = static_cast<uint32_t>(arc_edge_ids_.size());
+                arc_edge_ids_.push_back(edge_id);
+                arc_targets_.push_back(edge_to_[edge_id]);
+                arc_weights_.push_back(edge_weights_[edge_id]);
+            }
+        }
+
+        std::vector<IncidenceList>().swap(incidence_lists_);
+        std::vector<uint32_t>().swap(edge_to_);
+        std::vector<Weight>().swap(edge_weights_);
+        edge_from_.shrink_to_fit();
+        frozen_ = true;
     }
 
     template <typename Weight>
-    const Edge<Weight>& DirectedWeightedGraph<Weight>::GetEdge(EdgeId edge_id) const {
-        return edges_.at(edge_id);
+    bool DirectedWeightedGraph<Weight>::IsFrozen() const {
+        return frozen_;
     }
 
     template <typename Weight>
-    typename DirectedWeightedGraph<Weight>::IncidentEdgesRange
-        DirectedWeightedGraph<Weight>::GetIncidentEdges(VertexId vertex) const {
-        return ranges::AsRange(incidence_lists_.at(vertex));
+    size_t DirectedWeightedGraph<Weight>::GetVertexCount() const {
+        return vertex_count_;
     }
 
     template <typename Weight>
-    const std::vector<Edge<Weight>>& 
-        DirectedWeightedGraph<Weight>::GetVectorEdges() const {
-        return edges_;
+    size_t DirectedWeightedGraph<Weight>::GetEdgeCount() const {
+        return edge_from_.size();
     }
 
     template <typename Weight>
-    const std::vector<std::vector<EdgeId>>&
-        DirectedWeightedGraph<Weight>::GetList() const {
-        return incidence_lists_;
+    Edge<Weight> DirectedWeightedGraph<Weight>::GetEdge(EdgeId edge_id) const {
+        if (frozen_) {
+            const uint32_t position = edge_positions_[edge_id];
+            return { edge_from_[edge_id], arc_targets_[position], arc_weights_[position] };
+        }
+        return { edge_from_[edge_id], edge_to_[edge_id], edge_weights_[edge_id] };
     }
 
     template <typename Weight>
-    void DirectedWeightedGraph<Weight>::SetList(std::vector<std::vector<EdgeId>>&& other) {
-        incidence_lists_ = std::move(other);
+    typename DirectedWeightedGraph<Weight>::IncidentEdgesRange
+        DirectedWeightedGraph<Weight>::GetIncidentEdges(VertexId vertex) const {
+        if (frozen_) {
+            return { arc_edge_ids_.data() + offsets_[vertex], arc_edge_ids_.data() + offsets_[vertex + 1] };
+        }
+        const IncidenceList& list = incidence_lists_[vertex];
+        return { list.data(), list.data() + list.size() };
     }
 
     template <typename Weight>
-    void DirectedWeightedGraph<Weight>::SetVectorEdges(std::vector<Edge<Weight>>&& other) {
-        edges_ = std::move(other);
+    typename DirectedWeightedGraph<Weight>::IncidentArcs
+        DirectedWeightedGraph<Weight>::GetIncidentArcs(VertexId vertex) const {
+        if (!frozen_) {
+            throw std::logic_error("Graph should be frozen before reading arcs");
+        }
+        const uint32_t begin = offsets_[vertex];
+        return { arc_edge_ids_.data() + begin, arc_targets_.data() + begin, arc_weights_.data() + begin,
+            offsets_[vertex + 1] - begin };
     }
-}  // namespace graph
\ No newline at end of file
+}  // namespace graph
@@ -1,2397 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: graph.proto
-
-#include "graph.pb.h"
-
-#include <algorithm>
-
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/extension_set.h>
-#include <google/protobuf/wire_format_lite.h>
-#include <google/protobuf/descriptor.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/reflection_ops.h>
-#include <google/protobuf/wire_format.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Edge_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_EdgeForGraf_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_EdgeInfo_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IncidenceList_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_NameToVertex_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VertexBeginAndEnd_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VertexToName_graph_2eproto;
-namespace graph_serialize {
-class VertexToNameDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<VertexToName> _instance;
-} _VertexToName_default_instance_;
-class VertexBeginAndEndDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<VertexBeginAndEnd> _instance;
-} _VertexBeginAndEnd_default_instance_;
-class NameToVertexDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NameToVertex> _instance;
-} _NameToVertex_default_instance_;
-class EdgeForGrafDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<EdgeForGraf> _instance;
-} _EdgeForGraf_default_instance_;
-class EdgeInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<EdgeInfo> _instance;
-} _EdgeInfo_default_instance_;
-class IncidenceListDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<IncidenceList> _instance;
-} _IncidenceList_default_instance_;
-class EdgeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Edge> _instance;
-} _Edge_default_instance_;
-class GraphDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Graph> _instance;
-} _Graph_default_instance_;
-}  // namespace graph_serialize
-static void InitDefaultsscc_info_Edge_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::graph_serialize::_Edge_default_instance_;
-    new (ptr) ::graph_serialize::Edge();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::graph_serialize::Edge::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Edge_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Edge_graph_2eproto}, {}};
-
-static void InitDefaultsscc_info_EdgeForGraf_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::graph_serialize::_EdgeForGraf_default_instance_;
-    new (ptr) ::graph_serialize::EdgeForGraf();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::graph_serialize::EdgeForGraf::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_EdgeForGraf_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_EdgeForGraf_graph_2eproto}, {}};
-
-static void InitDefaultsscc_info_EdgeInfo_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::graph_serialize::_EdgeInfo_default_instance_;
-    new (ptr) ::graph_serialize::EdgeInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::graph_serialize::EdgeInfo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_EdgeInfo_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_EdgeInfo_graph_2eproto}, {
-      &scc_info_EdgeForGraf_graph_2eproto.base,}};
-
-static void InitDefaultsscc_info_Graph_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::graph_serialize::_Graph_default_instance_;
-    new (ptr) ::graph_serialize::Graph();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::graph_serialize::Graph::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Graph_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_Graph_graph_2eproto}, {
-      &scc_info_Edge_graph_2eproto.base,
-      &scc_info_IncidenceList_graph_2eproto.base,
-      &scc_info_EdgeInfo_graph_2eproto.base,
-      &scc_info_NameToVertex_graph_2eproto.base,
-      &scc_info_VertexToName_graph_2eproto.base,}};
-
-static void InitDefaultsscc_info_IncidenceList_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::graph_serialize::_IncidenceList_default_instance_;
-    new (ptr) ::graph_serialize::IncidenceList();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::graph_serialize::IncidenceList::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IncidenceList_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_IncidenceList_graph_2eproto}, {}};
-
-static void InitDefaultsscc_info_NameToVertex_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::graph_serialize::_NameToVertex_default_instance_;
-    new (ptr) ::graph_serialize::NameToVertex();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::graph_serialize::NameToVertex::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_NameToVertex_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_NameToVertex_graph_2eproto}, {
-      &scc_info_VertexBeginAndEnd_graph_2eproto.base,}};
-
-static void InitDefaultsscc_info_VertexBeginAndEnd_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::graph_serialize::_VertexBeginAndEnd_default_instance_;
-    new (ptr) ::graph_serialize::VertexBeginAndEnd();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::graph_serialize::VertexBeginAndEnd::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VertexBeginAndEnd_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_VertexBeginAndEnd_graph_2eproto}, {}};
-
-static void InitDefaultsscc_info_VertexToName_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::graph_serialize::_VertexToName_default_instance_;
-    new (ptr) ::graph_serialize::VertexToName();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::graph_serialize::VertexToName::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VertexToName_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_VertexToName_graph_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_graph_2eproto[8];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_graph_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_graph_2eproto = nullptr;
-
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_graph_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::VertexToName, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::VertexToName, id_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::VertexToName, name_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::VertexBeginAndEnd, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::VertexBeginAndEnd, begin_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::VertexBeginAndEnd, end_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::NameToVertex, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::NameToVertex, name_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::NameToVertex, id_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::EdgeForGraf, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::EdgeForGraf, time_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::EdgeForGraf, span_count_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::EdgeForGraf, bus_name_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::EdgeInfo, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::EdgeInfo, id_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::EdgeInfo, edge_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::IncidenceList, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::IncidenceList, edge_id_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Edge, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Edge, from_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Edge, to_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Edge, weight_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Graph, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Graph, edges_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Graph, incidience_lists_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Graph, info_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Graph, name_to_),
-  PROTOBUF_FIELD_OFFSET(::graph_serialize::Graph, vertex_to_),
-};
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::graph_serialize::VertexToName)},
-  { 7, -1, sizeof(::graph_serialize::VertexBeginAndEnd)},
-  { 14, -1, sizeof(::graph_serialize::NameToVertex)},
-  { 21, -1, sizeof(::graph_serialize::EdgeForGraf)},
-  { 29, -1, sizeof(::graph_serialize::EdgeInfo)},
-  { 36, -1, sizeof(::graph_serialize::IncidenceList)},
-  { 42, -1, sizeof(::graph_serialize::Edge)},
-  { 50, -1, sizeof(::graph_serialize::Graph)},
-};
-
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::graph_serialize::_VertexToName_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::graph_serialize::_VertexBeginAndEnd_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::graph_serialize::_NameToVertex_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::graph_serialize::_EdgeForGraf_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::graph_serialize::_EdgeInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::graph_serialize::_IncidenceList_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::graph_serialize::_Edge_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::graph_serialize::_Graph_default_instance_),
-};
-
-const char descriptor_table_protodef_graph_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\013graph.proto\022\017graph_serialize\"(\n\014Vertex"
-  "ToName\022\n\n\002id\030\001 \003(\r\022\014\n\004name\030\002 \003(\t\"/\n\021Vert"
-  "exBeginAndEnd\022\r\n\005begin\030\001 \001(\r\022\013\n\003end\030\002 \001("
-  "\r\"L\n\014NameToVertex\022\014\n\004name\030\001 \003(\t\022.\n\002id\030\002 "
-  "\003(\0132\".graph_serialize.VertexBeginAndEnd\""
-  "A\n\013EdgeForGraf\022\014\n\004time\030\001 \001(\001\022\022\n\nspan_cou"
-  "nt\030\002 \001(\005\022\020\n\010bus_name\030\003 \001(\t\"B\n\010EdgeInfo\022\n"
-  "\n\002id\030\001 \003(\r\022*\n\004edge\030\002 \003(\0132\034.graph_seriali"
-  "ze.EdgeForGraf\" \n\rIncidenceList\022\017\n\007edge_"
-  "id\030\001 \003(\r\"0\n\004Edge\022\014\n\004from\030\001 \001(\004\022\n\n\002to\030\002 \001"
-  "(\004\022\016\n\006weight\030\003 \001(\001\"\362\001\n\005Graph\022$\n\005edges\030\001 "
-  "\003(\0132\025.graph_serialize.Edge\0228\n\020incidience"
-  "_lists\030\002 \003(\0132\036.graph_serialize.Incidence"
-  "List\022\'\n\004info\030\003 \001(\0132\031.graph_serialize.Edg"
-  "eInfo\022.\n\007name_to\030\004 \001(\0132\035.graph_serialize"
-  ".NameToVertex\0220\n\tvertex_to\030\005 \001(\0132\035.graph"
-  "_serialize.VertexToNameb\006proto3"
-  ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_graph_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_graph_2eproto_sccs[8] = {
-  &scc_info_Edge_graph_2eproto.base,
-  &scc_info_EdgeForGraf_graph_2eproto.base,
-  &scc_info_EdgeInfo_graph_2eproto.base,
-  &scc_info_Graph_graph_2eproto.base,
-  &scc_info_IncidenceList_graph_2eproto.base,
-  &scc_info_NameToVertex_graph_2eproto.base,
-  &scc_info_VertexBeginAndEnd_graph_2eproto.base,
-  &scc_info_VertexToName_graph_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_graph_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_graph_2eproto = {
-  false, false, descriptor_table_protodef_graph_2eproto, "graph.proto", 671,
-  &descriptor_table_graph_2eproto_once, descriptor_table_graph_2eproto_sccs, descriptor_table_graph_2eproto_deps, 8, 0,
-  schemas, file_default_instances, TableStruct_graph_2eproto::offsets,
-  file_level_metadata_graph_2eproto, 8, file_level_enum_descriptors_graph_2eproto, file_level_service_descriptors_graph_2eproto,
-};
-
-// Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_graph_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_graph_2eproto)), true);
-namespace graph_serialize {
-
-// ===================================================================
-
-void VertexToName::InitAsDefaultInstance() {
-}
-class VertexToName::_Internal {
- public:
-};
-
-VertexToName::VertexToName(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  id_(arena),
-  name_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph_serialize.VertexToName)
-}
-VertexToName::VertexToName(const VertexToName& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      id_(from.id_),
-      name_(from.name_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:graph_serialize.VertexToName)
-}
-
-void VertexToName::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_VertexToName_graph_2eproto.base);
-}
-
-VertexToName::~VertexToName() {
-  // @@protoc_insertion_point(destructor:graph_serialize.VertexToName)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void VertexToName::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void VertexToName::ArenaDtor(void* object) {
-  VertexToName* _this = reinterpret_cast< VertexToName* >(object);
-  (void)_this;
-}
-void VertexToName::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void VertexToName::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const VertexToName& VertexToName::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_VertexToName_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void VertexToName::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph_serialize.VertexToName)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  id_.Clear();
-  name_.Clear();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* VertexToName::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // repeated uint32 id = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_id(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
-          _internal_add_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated string name = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_name();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "graph_serialize.VertexToName.name"));
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* VertexToName::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph_serialize.VertexToName)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated uint32 id = 1;
-  {
-    int byte_size = _id_cached_byte_size_.load(std::memory_order_relaxed);
-    if (byte_size > 0) {
-      target = stream->WriteUInt32Packed(
-          1, _internal_id(), byte_size, target);
-    }
-  }
-
-  // repeated string name = 2;
-  for (int i = 0, n = this->_internal_name_size(); i < n; i++) {
-    const auto& s = this->_internal_name(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "graph_serialize.VertexToName.name");
-    target = stream->WriteString(2, s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph_serialize.VertexToName)
-  return target;
-}
-
-size_t VertexToName::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph_serialize.VertexToName)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated uint32 id = 1;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->id_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
-    }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _id_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
-  }
-
-  // repeated string name = 2;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(name_.size());
-  for (int i = 0, n = name_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      name_.Get(i));
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void VertexToName::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:graph_serialize.VertexToName)
-  GOOGLE_DCHECK_NE(&from, this);
-  const VertexToName* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<VertexToName>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:graph_serialize.VertexToName)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:graph_serialize.VertexToName)
-    MergeFrom(*source);
-  }
-}
-
-void VertexToName::MergeFrom(const VertexToName& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:graph_serialize.VertexToName)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  id_.MergeFrom(from.id_);
-  name_.MergeFrom(from.name_);
-}
-
-void VertexToName::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:graph_serialize.VertexToName)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void VertexToName::CopyFrom(const VertexToName& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph_serialize.VertexToName)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool VertexToName::IsInitialized() const {
-  return true;
-}
-
-void VertexToName::InternalSwap(VertexToName* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  id_.InternalSwap(&other->id_);
-  name_.InternalSwap(&other->name_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata VertexToName::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void VertexBeginAndEnd::InitAsDefaultInstance() {
-}
-class VertexBeginAndEnd::_Internal {
- public:
-};
-
-VertexBeginAndEnd::VertexBeginAndEnd(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph_serialize.VertexBeginAndEnd)
-}
-VertexBeginAndEnd::VertexBeginAndEnd(const VertexBeginAndEnd& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&begin_, &from.begin_,
-    static_cast<size_t>(reinterpret_cast<char*>(&end_) -
-    reinterpret_cast<char*>(&begin_)) + sizeof(end_));
-  // @@protoc_insertion_point(copy_constructor:graph_serialize.VertexBeginAndEnd)
-}
-
-void VertexBeginAndEnd::SharedCtor() {
-  ::memset(&begin_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&end_) -
-      reinterpret_cast<char*>(&begin_)) + sizeof(end_));
-}
-
-VertexBeginAndEnd::~VertexBeginAndEnd() {
-  // @@protoc_insertion_point(destructor:graph_serialize.VertexBeginAndEnd)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void VertexBeginAndEnd::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void VertexBeginAndEnd::ArenaDtor(void* object) {
-  VertexBeginAndEnd* _this = reinterpret_cast< VertexBeginAndEnd* >(object);
-  (void)_this;
-}
-void VertexBeginAndEnd::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void VertexBeginAndEnd::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const VertexBeginAndEnd& VertexBeginAndEnd::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_VertexBeginAndEnd_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void VertexBeginAndEnd::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph_serialize.VertexBeginAndEnd)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&begin_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&end_) -
-      reinterpret_cast<char*>(&begin_)) + sizeof(end_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* VertexBeginAndEnd::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // uint32 begin = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint32 end = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* VertexBeginAndEnd::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph_serialize.VertexBeginAndEnd)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 begin = 1;
-  if (this->begin() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_begin(), target);
-  }
-
-  // uint32 end = 2;
-  if (this->end() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_end(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph_serialize.VertexBeginAndEnd)
-  return target;
-}
-
-size_t VertexBeginAndEnd::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph_serialize.VertexBeginAndEnd)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // uint32 begin = 1;
-  if (this->begin() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_begin());
-  }
-
-  // uint32 end = 2;
-  if (this->end() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_end());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void VertexBeginAndEnd::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:graph_serialize.VertexBeginAndEnd)
-  GOOGLE_DCHECK_NE(&from, this);
-  const VertexBeginAndEnd* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<VertexBeginAndEnd>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:graph_serialize.VertexBeginAndEnd)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:graph_serialize.VertexBeginAndEnd)
-    MergeFrom(*source);
-  }
-}
-
-void VertexBeginAndEnd::MergeFrom(const VertexBeginAndEnd& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:graph_serialize.VertexBeginAndEnd)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.begin() != 0) {
-    _internal_set_begin(from._internal_begin());
-  }
-  if (from.end() != 0) {
-    _internal_set_end(from._internal_end());
-  }
-}
-
-void VertexBeginAndEnd::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:graph_serialize.VertexBeginAndEnd)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void VertexBeginAndEnd::CopyFrom(const VertexBeginAndEnd& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph_serialize.VertexBeginAndEnd)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool VertexBeginAndEnd::IsInitialized() const {
-  return true;
-}
-
-void VertexBeginAndEnd::InternalSwap(VertexBeginAndEnd* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(VertexBeginAndEnd, end_)
-      + sizeof(VertexBeginAndEnd::end_)
-      - PROTOBUF_FIELD_OFFSET(VertexBeginAndEnd, begin_)>(
-          reinterpret_cast<char*>(&begin_),
-          reinterpret_cast<char*>(&other->begin_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata VertexBeginAndEnd::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void NameToVertex::InitAsDefaultInstance() {
-}
-class NameToVertex::_Internal {
- public:
-};
-
-NameToVertex::NameToVertex(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  name_(arena),
-  id_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph_serialize.NameToVertex)
-}
-NameToVertex::NameToVertex(const NameToVertex& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      name_(from.name_),
-      id_(from.id_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:graph_serialize.NameToVertex)
-}
-
-void NameToVertex::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_NameToVertex_graph_2eproto.base);
-}
-
-NameToVertex::~NameToVertex() {
-  // @@protoc_insertion_point(destructor:graph_serialize.NameToVertex)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void NameToVertex::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void NameToVertex::ArenaDtor(void* object) {
-  NameToVertex* _this = reinterpret_cast< NameToVertex* >(object);
-  (void)_this;
-}
-void NameToVertex::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void NameToVertex::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const NameToVertex& NameToVertex::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NameToVertex_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void NameToVertex::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph_serialize.NameToVertex)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  name_.Clear();
-  id_.Clear();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* NameToVertex::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // repeated string name = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_name();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "graph_serialize.NameToVertex.name"));
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // repeated .graph_serialize.VertexBeginAndEnd id = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_id(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* NameToVertex::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph_serialize.NameToVertex)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated string name = 1;
-  for (int i = 0, n = this->_internal_name_size(); i < n; i++) {
-    const auto& s = this->_internal_name(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "graph_serialize.NameToVertex.name");
-    target = stream->WriteString(1, s, target);
-  }
-
-  // repeated .graph_serialize.VertexBeginAndEnd id = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_id_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_id(i), target, stream);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph_serialize.NameToVertex)
-  return target;
-}
-
-size_t NameToVertex::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph_serialize.NameToVertex)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated string name = 1;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(name_.size());
-  for (int i = 0, n = name_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      name_.Get(i));
-  }
-
-  // repeated .graph_serialize.VertexBeginAndEnd id = 2;
-  total_size += 1UL * this->_internal_id_size();
-  for (const auto& msg : this->id_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void NameToVertex::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:graph_serialize.NameToVertex)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NameToVertex* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NameToVertex>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:graph_serialize.NameToVertex)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:graph_serialize.NameToVertex)
-    MergeFrom(*source);
-  }
-}
-
-void NameToVertex::MergeFrom(const NameToVertex& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:graph_serialize.NameToVertex)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  name_.MergeFrom(from.name_);
-  id_.MergeFrom(from.id_);
-}
-
-void NameToVertex::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:graph_serialize.NameToVertex)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void NameToVertex::CopyFrom(const NameToVertex& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph_serialize.NameToVertex)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool NameToVertex::IsInitialized() const {
-  return true;
-}
-
-void NameToVertex::InternalSwap(NameToVertex* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  name_.InternalSwap(&other->name_);
-  id_.InternalSwap(&other->id_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata NameToVertex::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void EdgeForGraf::InitAsDefaultInstance() {
-}
-class EdgeForGraf::_Internal {
- public:
-};
-
-EdgeForGraf::EdgeForGraf(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph_serialize.EdgeForGraf)
-}
-EdgeForGraf::EdgeForGraf(const EdgeForGraf& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  bus_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_bus_name().empty()) {
-    bus_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_bus_name(),
-      GetArena());
-  }
-  ::memcpy(&time_, &from.time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&span_count_) -
-    reinterpret_cast<char*>(&time_)) + sizeof(span_count_));
-  // @@protoc_insertion_point(copy_constructor:graph_serialize.EdgeForGraf)
-}
-
-void EdgeForGraf::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_EdgeForGraf_graph_2eproto.base);
-  bus_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&span_count_) -
-      reinterpret_cast<char*>(&time_)) + sizeof(span_count_));
-}
-
-EdgeForGraf::~EdgeForGraf() {
-  // @@protoc_insertion_point(destructor:graph_serialize.EdgeForGraf)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void EdgeForGraf::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  bus_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-
-void EdgeForGraf::ArenaDtor(void* object) {
-  EdgeForGraf* _this = reinterpret_cast< EdgeForGraf* >(object);
-  (void)_this;
-}
-void EdgeForGraf::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void EdgeForGraf::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const EdgeForGraf& EdgeForGraf::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_EdgeForGraf_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void EdgeForGraf::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph_serialize.EdgeForGraf)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  bus_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::memset(&time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&span_count_) -
-      reinterpret_cast<char*>(&time_)) + sizeof(span_count_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* EdgeForGraf::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // double time = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // int32 span_count = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          span_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string bus_name = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_bus_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "graph_serialize.EdgeForGraf.bus_name"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* EdgeForGraf::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph_serialize.EdgeForGraf)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double time = 1;
-  if (!(this->time() <= 0 && this->time() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_time(), target);
-  }
-
-  // int32 span_count = 2;
-  if (this->span_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_span_count(), target);
-  }
-
-  // string bus_name = 3;
-  if (this->bus_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_bus_name().data(), static_cast<int>(this->_internal_bus_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "graph_serialize.EdgeForGraf.bus_name");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_bus_name(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph_serialize.EdgeForGraf)
-  return target;
-}
-
-size_t EdgeForGraf::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph_serialize.EdgeForGraf)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string bus_name = 3;
-  if (this->bus_name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_bus_name());
-  }
-
-  // double time = 1;
-  if (!(this->time() <= 0 && this->time() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  // int32 span_count = 2;
-  if (this->span_count() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_span_count());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void EdgeForGraf::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:graph_serialize.EdgeForGraf)
-  GOOGLE_DCHECK_NE(&from, this);
-  const EdgeForGraf* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<EdgeForGraf>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:graph_serialize.EdgeForGraf)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:graph_serialize.EdgeForGraf)
-    MergeFrom(*source);
-  }
-}
-
-void EdgeForGraf::MergeFrom(const EdgeForGraf& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:graph_serialize.EdgeForGraf)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.bus_name().size() > 0) {
-    _internal_set_bus_name(from._internal_bus_name());
-  }
-  if (!(from.time() <= 0 && from.time() >= 0)) {
-    _internal_set_time(from._internal_time());
-  }
-  if (from.span_count() != 0) {
-    _internal_set_span_count(from._internal_span_count());
-  }
-}
-
-void EdgeForGraf::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:graph_serialize.EdgeForGraf)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void EdgeForGraf::CopyFrom(const EdgeForGraf& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph_serialize.EdgeForGraf)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool EdgeForGraf::IsInitialized() const {
-  return true;
-}
-
-void EdgeForGraf::InternalSwap(EdgeForGraf* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  bus_name_.Swap(&other->bus_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EdgeForGraf, span_count_)
-      + sizeof(EdgeForGraf::span_count_)
-      - PROTOBUF_FIELD_OFFSET(EdgeForGraf, time_)>(
-          reinterpret_cast<char*>(&time_),
-          reinterpret_cast<char*>(&other->time_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata EdgeForGraf::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void EdgeInfo::InitAsDefaultInstance() {
-}
-class EdgeInfo::_Internal {
- public:
-};
-
-EdgeInfo::EdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  id_(arena),
-  edge_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph_serialize.EdgeInfo)
-}
-EdgeInfo::EdgeInfo(const EdgeInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      id_(from.id_),
-      edge_(from.edge_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:graph_serialize.EdgeInfo)
-}
-
-void EdgeInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_EdgeInfo_graph_2eproto.base);
-}
-
-EdgeInfo::~EdgeInfo() {
-  // @@protoc_insertion_point(destructor:graph_serialize.EdgeInfo)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void EdgeInfo::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void EdgeInfo::ArenaDtor(void* object) {
-  EdgeInfo* _this = reinterpret_cast< EdgeInfo* >(object);
-  (void)_this;
-}
-void EdgeInfo::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void EdgeInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const EdgeInfo& EdgeInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_EdgeInfo_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void EdgeInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph_serialize.EdgeInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  id_.Clear();
-  edge_.Clear();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* EdgeInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // repeated uint32 id = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_id(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
-          _internal_add_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated .graph_serialize.EdgeForGraf edge = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_edge(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* EdgeInfo::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph_serialize.EdgeInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated uint32 id = 1;
-  {
-    int byte_size = _id_cached_byte_size_.load(std::memory_order_relaxed);
-    if (byte_size > 0) {
-      target = stream->WriteUInt32Packed(
-          1, _internal_id(), byte_size, target);
-    }
-  }
-
-  // repeated .graph_serialize.EdgeForGraf edge = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_edge_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_edge(i), target, stream);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph_serialize.EdgeInfo)
-  return target;
-}
-
-size_t EdgeInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph_serialize.EdgeInfo)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated uint32 id = 1;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->id_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
-    }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _id_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
-  }
-
-  // repeated .graph_serialize.EdgeForGraf edge = 2;
-  total_size += 1UL * this->_internal_edge_size();
-  for (const auto& msg : this->edge_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void EdgeInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:graph_serialize.EdgeInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const EdgeInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<EdgeInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:graph_serialize.EdgeInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:graph_serialize.EdgeInfo)
-    MergeFrom(*source);
-  }
-}
-
-void EdgeInfo::MergeFrom(const EdgeInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:graph_serialize.EdgeInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  id_.MergeFrom(from.id_);
-  edge_.MergeFrom(from.edge_);
-}
-
-void EdgeInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:graph_serialize.EdgeInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void EdgeInfo::CopyFrom(const EdgeInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph_serialize.EdgeInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool EdgeInfo::IsInitialized() const {
-  return true;
-}
-
-void EdgeInfo::InternalSwap(EdgeInfo* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  id_.InternalSwap(&other->id_);
-  edge_.InternalSwap(&other->edge_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata EdgeInfo::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void IncidenceList::InitAsDefaultInstance() {
-}
-class IncidenceList::_Internal {
- public:
-};
-
-IncidenceList::IncidenceList(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  edge_id_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph_serialize.IncidenceList)
-}
-IncidenceList::IncidenceList(const IncidenceList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      edge_id_(from.edge_id_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:graph_serialize.IncidenceList)
-}
-
-void IncidenceList::SharedCtor() {
-}
-
-IncidenceList::~IncidenceList() {
-  // @@protoc_insertion_point(destructor:graph_serialize.IncidenceList)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void IncidenceList::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void IncidenceList::ArenaDtor(void* object) {
-  IncidenceList* _this = reinterpret_cast< IncidenceList* >(object);
-  (void)_this;
-}
-void IncidenceList::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void IncidenceList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const IncidenceList& IncidenceList::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_IncidenceList_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void IncidenceList::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph_serialize.IncidenceList)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  edge_id_.Clear();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* IncidenceList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // repeated uint32 edge_id = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_edge_id(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
-          _internal_add_edge_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* IncidenceList::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph_serialize.IncidenceList)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated uint32 edge_id = 1;
-  {
-    int byte_size = _edge_id_cached_byte_size_.load(std::memory_order_relaxed);
-    if (byte_size > 0) {
-      target = stream->WriteUInt32Packed(
-          1, _internal_edge_id(), byte_size, target);
-    }
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph_serialize.IncidenceList)
-  return target;
-}
-
-size_t IncidenceList::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph_serialize.IncidenceList)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated uint32 edge_id = 1;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->edge_id_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
-    }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _edge_id_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void IncidenceList::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:graph_serialize.IncidenceList)
-  GOOGLE_DCHECK_NE(&from, this);
-  const IncidenceList* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<IncidenceList>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:graph_serialize.IncidenceList)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:graph_serialize.IncidenceList)
-    MergeFrom(*source);
-  }
-}
-
-void IncidenceList::MergeFrom(const IncidenceList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:graph_serialize.IncidenceList)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  edge_id_.MergeFrom(from.edge_id_);
-}
-
-void IncidenceList::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:graph_serialize.IncidenceList)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void IncidenceList::CopyFrom(const IncidenceList& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph_serialize.IncidenceList)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool IncidenceList::IsInitialized() const {
-  return true;
-}
-
-void IncidenceList::InternalSwap(IncidenceList* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  edge_id_.InternalSwap(&other->edge_id_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata IncidenceList::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Edge::InitAsDefaultInstance() {
-}
-class Edge::_Internal {
- public:
-};
-
-Edge::Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph_serialize.Edge)
-}
-Edge::Edge(const Edge& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&from_, &from.from_,
-    static_cast<size_t>(reinterpret_cast<char*>(&weight_) -
-    reinterpret_cast<char*>(&from_)) + sizeof(weight_));
-  // @@protoc_insertion_point(copy_constructor:graph_serialize.Edge)
-}
-
-void Edge::SharedCtor() {
-  ::memset(&from_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&weight_) -
-      reinterpret_cast<char*>(&from_)) + sizeof(weight_));
-}
-
-Edge::~Edge() {
-  // @@protoc_insertion_point(destructor:graph_serialize.Edge)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Edge::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void Edge::ArenaDtor(void* object) {
-  Edge* _this = reinterpret_cast< Edge* >(object);
-  (void)_this;
-}
-void Edge::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Edge::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Edge& Edge::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Edge_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Edge::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph_serialize.Edge)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&from_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&weight_) -
-      reinterpret_cast<char*>(&from_)) + sizeof(weight_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Edge::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // uint64 from = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint64 to = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // double weight = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25)) {
-          weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Edge::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph_serialize.Edge)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint64 from = 1;
-  if (this->from() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(1, this->_internal_from(), target);
-  }
-
-  // uint64 to = 2;
-  if (this->to() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(2, this->_internal_to(), target);
-  }
-
-  // double weight = 3;
-  if (!(this->weight() <= 0 && this->weight() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph_serialize.Edge)
-  return target;
-}
-
-size_t Edge::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph_serialize.Edge)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // uint64 from = 1;
-  if (this->from() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->_internal_from());
-  }
-
-  // uint64 to = 2;
-  if (this->to() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->_internal_to());
-  }
-
-  // double weight = 3;
-  if (!(this->weight() <= 0 && this->weight() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Edge::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:graph_serialize.Edge)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Edge* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Edge>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:graph_serialize.Edge)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:graph_serialize.Edge)
-    MergeFrom(*source);
-  }
-}
-
-void Edge::MergeFrom(const Edge& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:graph_serialize.Edge)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.from() != 0) {
-    _internal_set_from(from._internal_from());
-  }
-  if (from.to() != 0) {
-    _internal_set_to(from._internal_to());
-  }
-  if (!(from.weight() <= 0 && from.weight() >= 0)) {
-    _internal_set_weight(from._internal_weight());
-  }
-}
-
-void Edge::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:graph_serialize.Edge)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Edge::CopyFrom(const Edge& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph_serialize.Edge)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Edge::IsInitialized() const {
-  return true;
-}
-
-void Edge::InternalSwap(Edge* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Edge, weight_)
-      + sizeof(Edge::weight_)
-      - PROTOBUF_FIELD_OFFSET(Edge, from_)>(
-          reinterpret_cast<char*>(&from_),
-          reinterpret_cast<char*>(&other->from_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Edge::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Graph::InitAsDefaultInstance() {
-  ::graph_serialize::_Graph_default_instance_._instance.get_mutable()->info_ = const_cast< ::graph_serialize::EdgeInfo*>(
-      ::graph_serialize::EdgeInfo::internal_default_instance());
-  ::graph_serialize::_Graph_default_instance_._instance.get_mutable()->name_to_ = const_cast< ::graph_serialize::NameToVertex*>(
-      ::graph_serialize::NameToVertex::internal_default_instance());
-  ::graph_serialize::_Graph_default_instance_._instance.get_mutable()->vertex_to_ = const_cast< ::graph_serialize::VertexToName*>(
-      ::graph_serialize::VertexToName::internal_default_instance());
-}
-class Graph::_Internal {
- public:
-  static const ::graph_serialize::EdgeInfo& info(const Graph* msg);
-  static const ::graph_serialize::NameToVertex& name_to(const Graph* msg);
-  static const ::graph_serialize::VertexToName& vertex_to(const Graph* msg);
-};
-
-const ::graph_serialize::EdgeInfo&
-Graph::_Internal::info(const Graph* msg) {
-  return *msg->info_;
-}
-const ::graph_serialize::NameToVertex&
-Graph::_Internal::name_to(const Graph* msg) {
-  return *msg->name_to_;
-}
-const ::graph_serialize::VertexToName&
-Graph::_Internal::vertex_to(const Graph* msg) {
-  return *msg->vertex_to_;
-}
-Graph::Graph(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  edges_(arena),
-  incidience_lists_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:graph_serialize.Graph)
-}
-Graph::Graph(const Graph& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      edges_(from.edges_),
-      incidience_lists_(from.incidience_lists_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_info()) {
-    info_ = new ::graph_serialize::EdgeInfo(*from.info_);
-  } else {
-    info_ = nullptr;
-  }
-  if (from._internal_has_name_to()) {
-    name_to_ = new ::graph_serialize::NameToVertex(*from.name_to_);
-  } else {
-    name_to_ = nullptr;
-  }
-  if (from._internal_has_vertex_to()) {
-    vertex_to_ = new ::graph_serialize::VertexToName(*from.vertex_to_);
-  } else {
-    vertex_to_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:graph_serialize.Graph)
-}
-
-void Graph::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Graph_graph_2eproto.base);
-  ::memset(&info_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&vertex_to_) -
-      reinterpret_cast<char*>(&info_)) + sizeof(vertex_to_));
-}
-
-Graph::~Graph() {
-  // @@protoc_insertion_point(destructor:graph_serialize.Graph)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Graph::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete info_;
-  if (this != internal_default_instance()) delete name_to_;
-  if (this != internal_default_instance()) delete vertex_to_;
-}
-
-void Graph::ArenaDtor(void* object) {
-  Graph* _this = reinterpret_cast< Graph* >(object);
-  (void)_this;
-}
-void Graph::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Graph::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Graph& Graph::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Graph_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Graph::Clear() {
-// @@protoc_insertion_point(message_clear_start:graph_serialize.Graph)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  edges_.Clear();
-  incidience_lists_.Clear();
-  if (GetArena() == nullptr && info_ != nullptr) {
-    delete info_;
-  }
-  info_ = nullptr;
-  if (GetArena() == nullptr && name_to_ != nullptr) {
-    delete name_to_;
-  }
-  name_to_ = nullptr;
-  if (GetArena() == nullptr && vertex_to_ != nullptr) {
-    delete vertex_to_;
-  }
-  vertex_to_ = nullptr;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Graph::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // repeated .graph_serialize.Edge edges = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_edges(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // repeated .graph_serialize.IncidenceList incidience_lists = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_incidience_lists(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // .graph_serialize.EdgeInfo info = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_info(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .graph_serialize.NameToVertex name_to = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_name_to(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .graph_serialize.VertexToName vertex_to = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_vertex_to(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Graph::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:graph_serialize.Graph)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .graph_serialize.Edge edges = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_edges_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_edges(i), target, stream);
-  }
-
-  // repeated .graph_serialize.IncidenceList incidience_lists = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_incidience_lists_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_incidience_lists(i), target, stream);
-  }
-
-  // .graph_serialize.EdgeInfo info = 3;
-  if (this->has_info()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::info(this), target, stream);
-  }
-
-  // .graph_serialize.NameToVertex name_to = 4;
-  if (this->has_name_to()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::name_to(this), target, stream);
-  }
-
-  // .graph_serialize.VertexToName vertex_to = 5;
-  if (this->has_vertex_to()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::vertex_to(this), target, stream);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:graph_serialize.Graph)
-  return target;
-}
-
-size_t Graph::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:graph_serialize.Graph)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated .graph_serialize.Edge edges = 1;
-  total_size += 1UL * this->_internal_edges_size();
-  for (const auto& msg : this->edges_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // repeated .graph_serialize.IncidenceList incidience_lists = 2;
-  total_size += 1UL * this->_internal_incidience_lists_size();
-  for (const auto& msg : this->incidience_lists_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // .graph_serialize.EdgeInfo info = 3;
-  if (this->has_info()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *info_);
-  }
-
-  // .graph_serialize.NameToVertex name_to = 4;
-  if (this->has_name_to()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *name_to_);
-  }
-
-  // .graph_serialize.VertexToName vertex_to = 5;
-  if (this->has_vertex_to()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *vertex_to_);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Graph::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:graph_serialize.Graph)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Graph* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Graph>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:graph_serialize.Graph)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:graph_serialize.Graph)
-    MergeFrom(*source);
-  }
-}
-
-void Graph::MergeFrom(const Graph& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:graph_serialize.Graph)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  edges_.MergeFrom(from.edges_);
-  incidience_lists_.MergeFrom(from.incidience_lists_);
-  if (from.has_info()) {
-    _internal_mutable_info()->::graph_serialize::EdgeInfo::MergeFrom(from._internal_info());
-  }
-  if (from.has_name_to()) {
-    _internal_mutable_name_to()->::graph_serialize::NameToVertex::MergeFrom(from._internal_name_to());
-  }
-  if (from.has_vertex_to()) {
-    _internal_mutable_vertex_to()->::graph_serialize::VertexToName::MergeFrom(from._internal_vertex_to());
-  }
-}
-
-void Graph::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:graph_serialize.Graph)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Graph::CopyFrom(const Graph& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:graph_serialize.Graph)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Graph::IsInitialized() const {
-  return true;
-}
-
-void Graph::InternalSwap(Graph* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  edges_.InternalSwap(&other->edges_);
-  incidience_lists_.InternalSwap(&other->incidience_lists_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Graph, vertex_to_)
-      + sizeof(Graph::vertex_to_)
-      - PROTOBUF_FIELD_OFFSET(Graph, info_)>(
-          reinterpret_cast<char*>(&info_),
-          reinterpret_cast<char*>(&other->info_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Graph::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace graph_serialize
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::graph_serialize::VertexToName* Arena::CreateMaybeMessage< ::graph_serialize::VertexToName >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph_serialize::VertexToName >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph_serialize::VertexBeginAndEnd* Arena::CreateMaybeMessage< ::graph_serialize::VertexBeginAndEnd >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph_serialize::VertexBeginAndEnd >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph_serialize::NameToVertex* Arena::CreateMaybeMessage< ::graph_serialize::NameToVertex >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph_serialize::NameToVertex >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph_serialize::EdgeForGraf* Arena::CreateMaybeMessage< ::graph_serialize::EdgeForGraf >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph_serialize::EdgeForGraf >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph_serialize::EdgeInfo* Arena::CreateMaybeMessage< ::graph_serialize::EdgeInfo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph_serialize::EdgeInfo >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph_serialize::IncidenceList* Arena::CreateMaybeMessage< ::graph_serialize::IncidenceList >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph_serialize::IncidenceList >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph_serialize::Edge* Arena::CreateMaybeMessage< ::graph_serialize::Edge >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph_serialize::Edge >(arena);
-}
-template<> PROTOBUF_NOINLINE ::graph_serialize::Graph* Arena::CreateMaybeMessage< ::graph_serialize::Graph >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::graph_serialize::Graph >(arena);
-}
-PROTOBUF_NAMESPACE_CLOSE
-
-// @@protoc_insertion_point(global_scope)
-#include <google/protobuf/port_undef.inc>
@@ -192,7 +192,9 @@ json::Node output_json::SvgToJson(const svg::Document& doc, int id) {
 }
 
 RoutingSettings input_json::GetRoutingSettings(const json::Dict & dict) {
-	return RoutingSettings{ dict.at("bus_velocity").AsDouble(), dict.at("bus_wait_time").AsInt() };
+	return RoutingSettings{ dict.at("bus_velocity").AsDouble(), dict.at("bus_wait_time").AsInt(),
+		dict.count("precompute_routes") > 0 && dict.at("precompute_routes").AsBool(),
+		dict.count("contraction_hierarchy") > 0 && dict.at("contraction_hierarchy").AsBool() };
 }
 
 json::Node output_json::RouteToJson(std::optional<transport_router::detail::BuildRoute> route, int id) {
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <optional>
 #include <stdexcept>
@@ -41,7 +42,7 @@ namespace graph {
             for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
                 routes_internal_data_[vertex][vertex] = RouteInternalData{ ZERO_WEIGHT, std::nullopt };
                 for (const EdgeId edge_id : graph.GetIncidentEdges(vertex)) {
-                    const auto& edge = graph.GetEdge(edge_id);
+                    const auto edge = graph.GetEdge(edge_id);
                     if (edge.weight < ZERO_WEIGHT) {
                         throw std::domain_error("Edges' weights should be non-negative");
                     }
@@ -114,4 +115,158 @@ namespace graph {
         return RouteInfo{ weight, std::move(edges) };
     }
 
+    // Ищет маршрут между парой вершин по запросу алгоритмом Дейкстры. Подготовка - только
+    // проверка весов за O(E), памяти нужно O(V) на поток: рабочие массивы потока
+    // переиспользуются между запросами и перед каждым поиском сбрасываются по списку посещенных вершин.
+    // Граф должен быть заморожен: смежность обходится по массивам CSR.
+    template <typename Weight>
+    class DijkstraRouter {
+    private:
+        using Graph = DirectedWeightedGraph<Weight>;
+
+    public:
+        explicit DijkstraRouter(const Graph& graph);
+
+        using RouteInfo = typename Router<Weight>::RouteInfo;
+
+        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+
+        // Обходит кратчайшие пути из from во все достижимые вершины:
+        // function(vertex, weight, prev_edge), у самой from предыдущего ребра нет
+        template <typename Function>
+        void ForEachRouteFrom(VertexId from, Function function) const;
+
+    private:
+        enum class VertexState : uint8_t {
+            UNREACHED,
+            QUEUED,
+            SETTLED,
+        };
+
+        struct SearchState {
+            std::vector<Weight> weights;
+            std::vector<EdgeId> prev_edges;
+            std::vector<VertexState> states;
+            std::vector<VertexId> touched;
+            std::vector<std::pair<Weight, VertexId>> heap;
+
+            void Reset(size_t vertex_count) {
+                for (const VertexId vertex : touched) {
+                    states[vertex] = VertexState::UNREACHED;
+                }
+                touched.clear();
+                heap.clear();
+                if (states.size() < vertex_count) {
+                    weights.resize(vertex_count);
+                    prev_edges.resize(vertex_count);
+                    states.resize(vertex_count, VertexState::UNREACHED);
+                }
+            }
+        };
+
+        static SearchState& GetSearchState() {
+            thread_local SearchState state;
+            return state;
+        }
+
+        // Без target поиск идет до исчерпания кучи, и все посещенные вершины оказываются пройдены
+        SearchState& Search(VertexId from, std::optional<VertexId> target) const;
+
+        inline static Weight ZERO_WEIGHT{};
+        const Graph& graph_;
+    };
+
+    template <typename Weight>
+    DijkstraRouter<Weight>::DijkstraRouter(const Graph& graph)
+        : graph_(graph)
+    {
+        if (!graph.IsFrozen()) {
+            throw std::logic_error("Graph should be frozen before routing");
+        }
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+            if (graph.GetEdge(edge_id).weight < ZERO_WEIGHT) {
+                throw std::domain_error("Edges' weights should be non-negative");
+            }
+        }
+    }
+
+    template <typename Weight>
+    typename DijkstraRouter<Weight>::SearchState& DijkstraRouter<Weight>::Search(VertexId from,
+        std::optional<VertexId> target) const {
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (from >= vertex_count || (target && *target >= vertex_count)) {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+
+        SearchState& state = GetSearchState();
+        state.Reset(vertex_count);
+        const auto heap_order = std::greater<std::pair<Weight, VertexId>>();
+
+        state.weights[from] = ZERO_WEIGHT;
+        state.states[from] = VertexState::QUEUED;
+        state.touched.push_back(from);
+        state.heap.emplace_back(ZERO_WEIGHT, from);
+
+        while (!state.heap.empty()) {
+            std::pop_heap(state.heap.begin(), state.heap.end(), heap_order);
+            const auto [weight, vertex] = state.heap.back();
+            state.heap.pop_back();
+            // В куче остаются устаревшие записи вершин, до которых позже нашелся путь короче
+            if (state.states[vertex] == VertexState::SETTLED || state.weights[vertex] < weight) {
+                continue;
+            }
+            state.states[vertex] = VertexState::SETTLED;
+            if (vertex == target) {
+                break;
+            }
+
+            const auto arcs = graph_.GetIncidentArcs(vertex);
+            for (size_t i = 0; i < arcs.size; ++i) {
+                const VertexId head = arcs.targets[i];
+                const Weight candidate_weight = weight + arcs.weights[i];
+                VertexState& head_state = state.states[head];
+                if (head_state == VertexState::SETTLED
+                    || (head_state == VertexState::QUEUED && !(candidate_weight < state.weights[head]))) {
+                    continue;
+                }
+                if (head_state == VertexState::UNREACHED) {
+                    head_state = VertexState::QUEUED;
+                    state.touched.push_back(head);
+                }
+                state.weights[head] = candidate_weight;
+                state.prev_edges[head] = arcs.edge_ids[i];
+                state.heap.emplace_back(candidate_weight, head);
+                std::push_heap(state.heap.begin(), state.heap.end(), heap_order);
+            }
+        }
+
+        return state;
+    }
+
+    template <typename Weight>
+    std::optional<typename DijkstraRouter<Weight>::RouteInfo> DijkstraRouter<Weight>::BuildRoute(VertexId from,
+        VertexId to) const {
+        const SearchState& state = Search(from, to);
+        if (state.states[to] != VertexState::SETTLED) {
+            return std::nullopt;
+        }
+
+        std::vector<EdgeId> edges;
+        for (VertexId vertex = to; vertex != from; vertex = graph_.GetEdge(edges.back()).from) {
+            edges.push_back(state.prev_edges[vertex]);
+        }
+        std::reverse(edges.begin(), edges.end());
+
+        return RouteInfo{ state.weights[to], std::move(edges) };
+    }
+
+    template <typename Weight>
+    template <typename Function>
+    void DijkstraRouter<Weight>::ForEachRouteFrom(VertexId from, Function function) const {
+        const SearchState& state = Search(from, std::nullopt);
+        for (const VertexId vertex : state.touched) {
+            function(vertex, state.weights[vertex], vertex == from ? std::nullopt : std::optional<EdgeId>(state.prev_edges[vertex]));
+        }
+    }
+
 }  // namespace graph
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "graph.h"
+#include "router.h"
+#include "routing_table.h"
+#include "log_duration.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+// Сравнивает способы заполнить таблицу маршрутов между всеми парами на графе, устроенном как граф
+// справочника: у остановки вершины начала и конца с ребром ожидания, автобус соединяет каждую свою
+// остановку со всеми следующими в обе стороны. Остановки стоят в узлах квадратной сетки,
+// маршруты идут по соседним.
+// Usage: routing_benchmark [stop_count] [bus_count] [thread_count]
+
+namespace {
+
+	graph::DirectedWeightedGraph<double> MakeTransportGraph(size_t stop_count, size_t bus_count) {
+
+		static const double bus_wait_time = 6.0;
+
+		const size_t side = std::max<size_t>(static_cast<size_t>(std::sqrt(static_cast<double>(stop_count))), 2);
+		stop_count = side * side;
+
+		graph::DirectedWeightedGraph<double> graph(stop_count * 2);
+		for (size_t stop = 0; stop < stop_count; ++stop) {
+			graph.AddEdge({ stop * 2, stop * 2 + 1, bus_wait_time });
+		}
+
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<double> span_time(0.5, 7.5);
+
+		for (size_t bus = 0; bus < bus_count; ++bus) {
+			std::vector<size_t> route{ generator() % stop_count };
+			const size_t length = 5 + generator() % 20;
+
+			while (route.size() < length) {
+				const size_t x = route.back() % side;
+				const size_t y = route.back() / side;
+				const size_t next = generator() % 2 == 0
+					? (x + 1 < side ? x + 1 : x - 1) + y * side
+					: x + (y + 1 < side ? y + 1 : y - 1) * side;
+				if (std::find(route.begin(), route.end(), next) != route.end()) {
+					break;
+				}
+				route.push_back(next);
+			}
+
+			std::vector<double> spans;
+			for (size_t i = 1; i < route.size(); ++i) {
+				spans.push_back(span_time(generator));
+			}
+
+			for (size_t first = 0; first + 1 < route.size(); ++first) {
+				double time = 0;
+				for (size_t second = first + 1; second < route.size(); ++second) {
+					time += spans[second - 1];
+					graph.AddEdge({ route[first] * 2 + 1, route[second] * 2, time });
+					graph.AddEdge({ route[second] * 2 + 1, route[first] * 2, time });
+				}
+			}
+		}
+
+		graph.Freeze();
+		return graph;
+	}
+
+	size_t CountMismatches(const graph::RoutingTable<double>& expected, const graph::RoutingTable<double>& table) {
+		size_t mismatches = 0;
+		for (size_t i = 0; i < expected.weights.size(); ++i) {
+			if ((expected.prev_edges[i] == graph::RoutingTable<double>::NO_EDGE) != (table.prev_edges[i] == graph::RoutingTable<double>::NO_EDGE)
+				|| std::abs(expected.weights[i] - table.weights[i]) > 1e-9 * std::max(1.0, expected.weights[i])) {
+				++mismatches;
+			}
+		}
+		return mismatches;
+	}
+
+	// Каждое четвертое ребро нулевого веса, так что в графе есть циклы нулевого веса. Ребер столько,
+	// что по оценке работы BuildRoutingTableAuto выбрал бы Флойда-Уоршелла по блокам
+	graph::DirectedWeightedGraph<double> MakeZeroWeightCycleGraph() {
+
+		static const size_t vertex_count = 300;
+
+		graph::DirectedWeightedGraph<double> graph(vertex_count);
+		std::mt19937 generator(42);
+		for (size_t i = 0; i < vertex_count * 12; ++i) {
+			const size_t from = generator() % vertex_count;
+			const size_t to = generator() % vertex_count;
+			graph.AddEdge({ from, to, generator() % 4 == 0 ? 0.0 : 1.0 + generator() % 5 });
+		}
+
+		graph.Freeze();
+		return graph;
+	}
+
+	// Возвращает число нарушений: маршруты по таблице для графа с циклами нулевого веса должны собираться
+	// и совпадать с поиском Дейкстры, Флойд-Уоршелл по блокам такой граф не принимает,
+	// а цикл из последних ребер в таблице TableRouter сообщает исключением
+	size_t CheckZeroWeightCycles() {
+		size_t failures = 0;
+
+		const graph::DirectedWeightedGraph<double> graph = MakeZeroWeightCycleGraph();
+		const graph::RoutingTable<double> table = graph::BuildRoutingTableAuto(graph);
+		failures += CountMismatches(graph::BuildRoutingTable(graph), table);
+
+		const graph::TableRouter<double> router(graph, table);
+		for (graph::VertexId from = 0; from < graph.GetVertexCount(); ++from) {
+			for (graph::VertexId to = 0; to < graph.GetVertexCount(); ++to) {
+				try {
+					const auto route = router.BuildRoute(from, to);
+					if (route && !route->edges.empty() && (graph.GetEdge(route->edges.front()).from != from
+						|| graph.GetEdge(route->edges.back()).to != to)) {
+						++failures;
+					}
+				}
+				catch (const std::logic_error&) {
+					++failures;
+				}
+			}
+		}
+
+		try {
+			graph::BuildRoutingTableBlocked(graph);
+			++failures;
+		}
+		catch (const std::domain_error&) {
+		}
+
+		// Последние ребра маршрутов из 0 в 1 и в 2 ссылаются друг на друга
+		graph::DirectedWeightedGraph<double> cyclic_graph(3);
+		cyclic_graph.AddEdge({ 0, 1, 1.0 });
+		cyclic_graph.AddEdge({ 1, 2, 1.0 });
+		cyclic_graph.AddEdge({ 2, 1, 1.0 });
+		cyclic_graph.Freeze();
+
+		graph::RoutingTable<double> cyclic_table = graph::BuildRoutingTable(cyclic_graph);
+		cyclic_table.prev_edges[cyclic_table.GetIndex(0, 1)] = 2;
+		try {
+			graph::TableRouter<double>(cyclic_graph, cyclic_table).BuildRoute(0, 2);
+			++failures;
+		}
+		catch (const std::logic_error&) {
+		}
+
+		return failures;
+	}
+}
+
+int main(int argc, char* argv[]) {
+
+	const size_t stop_count = argc > 1 ? std::stoul(argv[1]) : 700;
+	const size_t bus_count = argc > 2 ? std::stoul(argv[2]) : 300;
+	const size_t thread_count = argc > 3 ? std::stoul(argv[3]) : std::thread::hardware_concurrency();
+
+	const graph::DirectedWeightedGraph<double> graph = MakeTransportGraph(stop_count, bus_count);
+	std::cerr << "Vertices: "s << graph.GetVertexCount() << ", edges: "s << graph.GetEdgeCount()
+		<< ", threads: "s << thread_count << std::endl;
+
+	std::optional<graph::Router<double>> router;
+	{
+		LOG_DURATION("Router (Floyd-Warshall over vector<vector<optional>>)"s);
+		router.emplace(graph);
+	}
+
+	std::optional<graph::RoutingTable<double>> dijkstra_table;
+	{
+		LOG_DURATION("BuildRoutingTable (Dijkstra from every vertex)"s);
+		dijkstra_table = graph::BuildRoutingTable(graph, thread_count);
+	}
+
+	std::optional<graph::RoutingTable<double>> blocked_table;
+	{
+		LOG_DURATION("BuildRoutingTableBlocked (blocked Floyd-Warshall)"s);
+		blocked_table = graph::BuildRoutingTableBlocked(graph, thread_count);
+	}
+
+	const size_t mismatches = CountMismatches(*dijkstra_table, *blocked_table);
+	std::cerr << "Mismatched pairs: "s << mismatches << std::endl;
+
+	const size_t zero_weight_failures = CheckZeroWeightCycles();
+	std::cerr << "Zero-weight cycle check failures: "s << zero_weight_failures << std::endl;
+
+	return mismatches == 0 && zero_weight_failures == 0 ? 0 : 1;
+}
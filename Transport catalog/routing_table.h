@@ -0,0 +1,283 @@
+#pragma once
+
+#include "graph.h"
+#include "router.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+    // Кратчайшие пути между всеми парами вершин в плоских массивах по строкам (строка - начало маршрута).
+    // Для пары хранится вес и последнее ребро маршрута; NO_EDGE - пути нет или начало совпадает с концом.
+    template <typename Weight>
+    struct RoutingTable {
+        static constexpr uint32_t NO_EDGE = std::numeric_limits<uint32_t>::max();
+
+        size_t vertex_count = 0;
+        std::vector<Weight> weights;
+        std::vector<uint32_t> prev_edges;
+
+        inline size_t GetIndex(VertexId from, VertexId to) const noexcept {
+            return from * vertex_count + to;
+        }
+
+        inline bool HasRoute(VertexId from, VertexId to) const noexcept {
+            return from == to || prev_edges[GetIndex(from, to)] != NO_EDGE;
+        }
+    };
+
+    namespace detail {
+
+        // Раздает задачи 0..task_count-1 потокам по одной; вызывающий поток тоже считает,
+        // поэтому дополнительных потоков на один меньше
+        template <typename Task>
+        void RunInParallel(size_t task_count, size_t thread_count, Task task) {
+            std::atomic<size_t> next_task{ 0 };
+            auto run_tasks = [&]() {
+                for (size_t i = next_task++; i < task_count; i = next_task++) {
+                    task(i);
+                }
+            };
+
+            const size_t worker_count = std::min(std::max<size_t>(thread_count, 1), std::max<size_t>(task_count, 1));
+            std::vector<std::thread> workers;
+            for (size_t i = 1; i < worker_count; ++i) {
+                workers.emplace_back(run_tasks);
+            }
+            run_tasks();
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+
+        template <typename Weight>
+        RoutingTable<Weight> MakeEmptyRoutingTable(const DirectedWeightedGraph<Weight>& graph) {
+            if (graph.GetEdgeCount() >= RoutingTable<Weight>::NO_EDGE) {
+                throw std::length_error("Too many edges for a routing table");
+            }
+
+            const size_t vertex_count = graph.GetVertexCount();
+            RoutingTable<Weight> table;
+            table.vertex_count = vertex_count;
+            table.weights.assign(vertex_count * vertex_count, std::numeric_limits<Weight>::max());
+            table.prev_edges.assign(vertex_count * vertex_count, RoutingTable<Weight>::NO_EDGE);
+            return table;
+        }
+
+        // Ребро нулевого веса между разными вершинами. Через цикл из таких ребер Флойд-Уоршелл по блокам
+        // при равных весах замыкает последние ребра маршрутов в цикл
+        template <typename Weight>
+        bool HasZeroWeightEdge(const DirectedWeightedGraph<Weight>& graph) {
+            for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+                const auto edge = graph.GetEdge(edge_id);
+                if (edge.from != edge.to && edge.weight == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Шаг Флойда-Уоршелла для блока строк rows и столбцов columns через вершины блока via.
+        // Вершины via перебираются во внешнем цикле, поэтому блок может совпадать с блоками
+        // строки или столбца via. Внутренний цикл без ветвлений, чтобы компилятор его векторизовал.
+        template <typename Weight>
+        void RelaxBlock(RoutingTable<Weight>& table, std::pair<size_t, size_t> rows,
+            std::pair<size_t, size_t> columns, std::pair<size_t, size_t> via) {
+            const size_t vertex_count = table.vertex_count;
+            Weight* const weights = table.weights.data();
+            uint32_t* const prev_edges = table.prev_edges.data();
+
+            for (size_t k = via.first; k < via.second; ++k) {
+                const Weight* const via_weights = weights + k * vertex_count;
+                const uint32_t* const via_prev_edges = prev_edges + k * vertex_count;
+
+                for (size_t i = rows.first; i < rows.second; ++i) {
+                    Weight* const row_weights = weights + i * vertex_count;
+                    uint32_t* const row_prev_edges = prev_edges + i * vertex_count;
+                    const Weight to_via = row_weights[k];
+                    // Через k пути нет, либо строка самой k: ее через k не улучшить
+                    if (i == k || !(to_via < std::numeric_limits<Weight>::max())) {
+                        continue;
+                    }
+
+                    for (size_t j = columns.first; j < columns.second; ++j) {
+                        const Weight candidate = to_via + via_weights[j];
+                        const Weight current = row_weights[j];
+                        const uint32_t current_prev_edge = row_prev_edges[j];
+                        const bool is_shorter = candidate < current;
+                        row_weights[j] = is_shorter ? candidate : current;
+                        row_prev_edges[j] = is_shorter ? via_prev_edges[j] : current_prev_edge;
+                    }
+                }
+            }
+        }
+    }
+
+    // Заполняет таблицу поиском Дейкстры из каждой вершины; строки независимы и считаются в thread_count потоках
+    template <typename Weight>
+    RoutingTable<Weight> BuildRoutingTable(const DirectedWeightedGraph<Weight>& graph,
+        size_t thread_count = std::thread::hardware_concurrency()) {
+        RoutingTable<Weight> table = detail::MakeEmptyRoutingTable(graph);
+
+        const DijkstraRouter<Weight> router(graph);
+        detail::RunInParallel(table.vertex_count, thread_count, [&](VertexId from) {
+            router.ForEachRouteFrom(from, [&](VertexId to, Weight weight, std::optional<EdgeId> prev_edge) {
+                table.weights[table.GetIndex(from, to)] = weight;
+                if (prev_edge) {
+                    table.prev_edges[table.GetIndex(from, to)] = static_cast<uint32_t>(*prev_edge);
+                }
+            });
+        });
+
+        return table;
+    }
+
+    // Заполняет ту же таблицу алгоритмом Флойда-Уоршелла по блокам block_size x block_size.
+    // Раунд на каждый диагональный блок: сначала сам блок, затем остальные блоки его строки и столбца,
+    // затем все прочие блоки. Блоки второй и третьей фазы независимы и считаются в thread_count потоках.
+    // O(V^3) без куч и списков смежности: выгоднее поиска Дейкстры на плотных графах.
+    // Веса ребер между разными вершинами должны быть положительными, иначе маршруты в таблице могут зациклиться.
+    template <typename Weight>
+    RoutingTable<Weight> BuildRoutingTableBlocked(const DirectedWeightedGraph<Weight>& graph,
+        size_t thread_count = std::thread::hardware_concurrency(), size_t block_size = 128) {
+        static_assert(std::is_floating_point_v<Weight>, "Blocked Floyd-Warshall needs floating-point weights");
+
+        RoutingTable<Weight> table = detail::MakeEmptyRoutingTable(graph);
+        const size_t vertex_count = table.vertex_count;
+
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+            table.weights[table.GetIndex(vertex, vertex)] = 0;
+        }
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+            const auto edge = graph.GetEdge(edge_id);
+            if (edge.weight < 0) {
+                throw std::domain_error("Edges' weights should be non-negative");
+            }
+            if (edge.from != edge.to && edge.weight == 0) {
+                throw std::domain_error("Blocked Floyd-Warshall needs positive edge weights");
+            }
+            const size_t index = table.GetIndex(edge.from, edge.to);
+            if (edge.from != edge.to && edge.weight < table.weights[index]) {
+                table.weights[index] = edge.weight;
+                table.prev_edges[index] = static_cast<uint32_t>(edge_id);
+            }
+        }
+
+        block_size = std::max<size_t>(block_size, 1);
+        const size_t block_count = (vertex_count + block_size - 1) / block_size;
+        auto get_range = [&](size_t block) {
+            return std::pair{ block * block_size, std::min(vertex_count, (block + 1) * block_size) };
+        };
+
+        for (size_t via_block = 0; via_block < block_count; ++via_block) {
+            const auto via = get_range(via_block);
+            detail::RelaxBlock(table, via, via, via);
+
+            // Задачи 0..block_count-1 - блоки строки via, остальные - блоки столбца
+            detail::RunInParallel(2 * block_count, thread_count, [&](size_t task) {
+                const size_t block = task % block_count;
+                if (block == via_block) {
+                    return;
+                }
+                if (task < block_count) {
+                    detail::RelaxBlock(table, via, get_range(block), via);
+                }
+                else {
+                    detail::RelaxBlock(table, get_range(block), via, via);
+                }
+            });
+
+            detail::RunInParallel(block_count * block_count, thread_count, [&](size_t task) {
+                const size_t row_block = task / block_count;
+                const size_t column_block = task % block_count;
+                if (row_block != via_block && column_block != via_block) {
+                    detail::RelaxBlock(table, get_range(row_block), get_range(column_block), via);
+                }
+            });
+        }
+
+        return table;
+    }
+
+    // Выбирает способ по оценке работы: V * E * log V у поиска Дейкстры из каждой вершины против V^3
+    // у Флойда-Уоршелла по блокам, шаг которого в несколько раз дешевле (см. routing_benchmark).
+    // Графы с ребрами нулевого веса всегда считаются поиском Дейкстры.
+    template <typename Weight>
+    RoutingTable<Weight> BuildRoutingTableAuto(const DirectedWeightedGraph<Weight>& graph,
+        size_t thread_count = std::thread::hardware_concurrency()) {
+        const double vertex_count = static_cast<double>(graph.GetVertexCount());
+        const double dijkstra_work = 4.0 * static_cast<double>(graph.GetEdgeCount()) * std::log2(vertex_count + 1);
+        if (vertex_count * vertex_count < dijkstra_work && !detail::HasZeroWeightEdge(graph)) {
+            return BuildRoutingTableBlocked(graph, thread_count);
+        }
+        return BuildRoutingTable(graph, thread_count);
+    }
+
+    // Отвечает на запросы по готовой таблице без пересчета
+    template <typename Weight>
+    class TableRouter {
+    private:
+        using Graph = DirectedWeightedGraph<Weight>;
+
+    public:
+        TableRouter(const Graph& graph, const RoutingTable<Weight>& table);
+
+        using RouteInfo = typename Router<Weight>::RouteInfo;
+
+        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+
+    private:
+        const Graph& graph_;
+        const RoutingTable<Weight>& table_;
+    };
+
+    template <typename Weight>
+    TableRouter<Weight>::TableRouter(const Graph& graph, const RoutingTable<Weight>& table)
+        : graph_(graph)
+        , table_(table)
+    {
+        const size_t cell_count = table.vertex_count * table.vertex_count;
+        if (table.vertex_count != graph.GetVertexCount() || table.weights.size() != cell_count || table.prev_edges.size() != cell_count) {
+            throw std::invalid_argument("Routing table does not match the graph");
+        }
+        for (const uint32_t edge_id : table.prev_edges) {
+            if (edge_id != RoutingTable<Weight>::NO_EDGE && edge_id >= graph.GetEdgeCount()) {
+                throw std::invalid_argument("Routing table refers to a missing edge");
+            }
+        }
+    }
+
+    template <typename Weight>
+    std::optional<typename TableRouter<Weight>::RouteInfo> TableRouter<Weight>::BuildRoute(VertexId from,
+        VertexId to) const {
+        if (from >= table_.vertex_count || to >= table_.vertex_count) {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+        if (!table_.HasRoute(from, to)) {
+            return std::nullopt;
+        }
+
+        std::vector<EdgeId> edges;
+        for (VertexId vertex = to; vertex != from; vertex = graph_.GetEdge(edges.back()).from) {
+            // В маршруте без повторов меньше vertex_count ребер
+            if (edges.size() == table_.vertex_count) {
+                throw std::logic_error("Routing table has a cycle of route edges");
+            }
+            edges.push_back(table_.prev_edges[table_.GetIndex(from, vertex)]);
+        }
+        std::reverse(edges.begin(), edges.end());
+
+        return RouteInfo{ table_.weights[table_.GetIndex(from, to)], std::move(edges) };
+    }
+
+}  // namespace graph
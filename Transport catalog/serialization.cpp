@@ -1,11 +1,20 @@
 #include "serialization.h"
 #include "svg.h"
 
+#include <stdexcept>
 #include <string>
 #include <ostream>
 #include <variant>
 #include <vector>
 
+namespace {
+
+// Таблица хранит V * V весов и рёбер, а сообщение protobuf не может быть больше 2 ГБ.
+// 10000 вершин дают около 1.3 ГБ, поэтому остаётся запас на остальную базу.
+constexpr size_t MAX_PRECOMPUTED_VERTICES = 10000;
+
+}
+
 void SerializationCatalog(const InformationForCatalog& query,
 	transport_set::Transport_set& trans_list) {
 
@@ -81,8 +90,9 @@ void SerializationMap(const renderer_for_set::RenderSettings& render_set,
 void SomeGraph(graph_serialize::Graph& graph_ser,
 	const graph::DirectedWeightedGraph<double>& graph) {
 
-	for (const auto& edge : graph.GetVectorEdges()) {
+	for (graph::EdgeId id = 0; id < graph.GetEdgeCount(); id++) {
 
+		const graph::Edge<double> edge = graph.GetEdge(id);
 		graph_serialize::Edge edge_ser;
 
 		edge_ser.set_from(edge.from);
@@ -92,11 +102,11 @@ void SomeGraph(graph_serialize::Graph& graph_ser,
 		*graph_ser.add_edges() = std::move(edge_ser);
 	}
 
-	for (const auto& edge_id : graph.GetList()) {
+	for (graph::VertexId vertex = 0; vertex < graph.GetVertexCount(); vertex++) {
 
 		graph_serialize::IncidenceList list;
 
-		for (const auto id : edge_id) {
+		for (const auto id : graph.GetIncidentEdges(vertex)) {
 			list.add_edge_id(id);
 		}	
 
@@ -156,6 +166,47 @@ void SerializationGraph(const transport_router::InitGraph& init,
 	SerializationAllMapForGraph(graph, init);
 }
 
+void SerializationRoutes(const graph::RoutingTable<double>& table,
+	graph_serialize::Graph& graph) {
+
+	graph_serialize::RoutingTable routes;
+
+	routes.set_vertex_count(static_cast<uint32_t>(table.vertex_count));
+
+	routes.mutable_weights()->Reserve(static_cast<int>(table.weights.size()));
+	for (const double weight : table.weights) {
+		routes.add_weights(weight);
+	}
+
+	routes.mutable_prev_edges()->Reserve(static_cast<int>(table.prev_edges.size()));
+	for (const uint32_t edge_id : table.prev_edges) {
+		routes.add_prev_edges(edge_id == graph::RoutingTable<double>::NO_EDGE ? 0 : edge_id + 1);
+	}
+
+	*graph.mutable_routes() = std::move(routes);
+}
+
+void SerializationHierarchy(const graph::ContractionHierarchy<double>& hierarchy,
+	graph_serialize::Graph& graph) {
+
+	graph_serialize::ContractionHierarchy ser;
+
+	ser.mutable_ranks()->Reserve(static_cast<int>(hierarchy.ranks.size()));
+	for (const uint32_t rank : hierarchy.ranks) {
+		ser.add_ranks(rank);
+	}
+
+	for (const auto& shortcut : hierarchy.shortcuts) {
+		ser.add_shortcut_from(static_cast<uint32_t>(shortcut.from));
+		ser.add_shortcut_to(static_cast<uint32_t>(shortcut.to));
+		ser.add_shortcut_weight(shortcut.weight);
+		ser.add_shortcut_first(static_cast<uint32_t>(shortcut.first));
+		ser.add_shortcut_second(static_cast<uint32_t>(shortcut.second));
+	}
+
+	*graph.mutable_hierarchy() = std::move(ser);
+}
+
 void Serialization(std::ofstream& out,
 	const InformationForCatalog& query,
 	const renderer_for_set::RenderSettings& render_set,
@@ -170,6 +221,19 @@ void Serialization(std::ofstream& out,
 	SerializationMap(render_set, render);
 	SerializationGraph(init, graph);
 
+	if (query.routing_settings.precompute_routes) {
+		const size_t vertex_count = init.GetGraph().GetVertexCount();
+		if (vertex_count > MAX_PRECOMPUTED_VERTICES) {
+			throw std::invalid_argument("precompute_routes supports at most " + std::to_string(MAX_PRECOMPUTED_VERTICES)
+				+ " graph vertices, the graph has " + std::to_string(vertex_count));
+		}
+		SerializationRoutes(graph::BuildRoutingTableAuto(init.GetGraph()), graph);
+	}
+	else if (query.routing_settings.contraction_hierarchy) {
+		// Роутер берёт таблицу раньше иерархии, поэтому вместе с таблицей иерархию не строим
+		SerializationHierarchy(graph::BuildContractionHierarchy(init.GetGraph()), graph);
+	}
+
 	*trans_list.mutable_ren() = std::move(render);
 	*trans_list.mutable_graph() = std::move(graph);
 
@@ -251,26 +315,19 @@ renderer_for_set::RenderSettings DeserializeMap(transport_set::Transport_set& re
 void DeserializeSomeGraph(transport_set::Transport_set& render, 
 	transport_router::detail::InputSerialization& for_init) {
 
+	// Списки смежности в базе - ребра каждой вершины по возрастанию id, ровно в таком порядке
+	// их собирает AddEdge, поэтому граф восстанавливается по одним ребрам
+	for_init.graph = graph::DirectedWeightedGraph<double>(render.graph().incidience_lists_size());
+
 	for (int i = 0; i < render.graph().edges_size(); i++) {
 
 		graph::Edge<double> new_edge;
 
-		new_edge.from = render.mutable_graph()->mutable_edges(i)->from();
-		new_edge.to = render.mutable_graph()->mutable_edges(i)->to();
-		new_edge.weight = render.mutable_graph()->mutable_edges(i)->weight();
-
-		for_init.edges.push_back(std::move(new_edge));
-	}
-
-	for (int i = 0; i < render.graph().incidience_lists_size(); i++) {
-
-		std::vector<size_t> one;
-
-		for (int j = 0; j < render.graph().incidience_lists(i).edge_id_size(); j++) {
-			one.push_back(render.graph().incidience_lists(i).edge_id(j));
-		}
+		new_edge.from = render.graph().edges(i).from();
+		new_edge.to = render.graph().edges(i).to();
+		new_edge.weight = render.graph().edges(i).weight();
 
-		for_init.incidence_lists.push_back(std::move(one));
+		for_init.graph.AddEdge(new_edge);
 	}
 }
 
@@ -301,6 +358,42 @@ void DeserializeMapForGraph(transport_set::Transport_set& render,
 	}
 }
 
+graph::RoutingTable<double> DeserializeRoutes(const graph_serialize::RoutingTable& routes) {
+
+	graph::RoutingTable<double> table;
+
+	table.vertex_count = routes.vertex_count();
+	table.weights.assign(routes.weights().begin(), routes.weights().end());
+
+	table.prev_edges.reserve(routes.prev_edges_size());
+	for (const uint32_t edge_id : routes.prev_edges()) {
+		table.prev_edges.push_back(edge_id == 0 ? graph::RoutingTable<double>::NO_EDGE : edge_id - 1);
+	}
+
+	return table;
+}
+
+graph::ContractionHierarchy<double> DeserializeHierarchy(const graph_serialize::ContractionHierarchy& ser) {
+
+	graph::ContractionHierarchy<double> hierarchy;
+
+	hierarchy.ranks.assign(ser.ranks().begin(), ser.ranks().end());
+
+	const int shortcut_count = ser.shortcut_from_size();
+	if (ser.shortcut_to_size() != shortcut_count || ser.shortcut_weight_size() != shortcut_count
+		|| ser.shortcut_first_size() != shortcut_count || ser.shortcut_second_size() != shortcut_count) {
+		throw std::invalid_argument("Contraction hierarchy shortcuts are truncated");
+	}
+
+	hierarchy.shortcuts.reserve(shortcut_count);
+	for (int i = 0; i < shortcut_count; ++i) {
+		hierarchy.shortcuts.push_back({ ser.shortcut_from(i), ser.shortcut_to(i), ser.shortcut_weight(i),
+			ser.shortcut_first(i), ser.shortcut_second(i) });
+	}
+
+	return hierarchy;
+}
+
 transport_router::detail::InputSerialization DeserializeGraph(transport_set::Transport_set& render) {
 
 	transport_router::detail::InputSerialization for_init;
@@ -308,5 +401,13 @@ transport_router::detail::InputSerialization DeserializeGraph(transport_set::Tra
 	DeserializeSomeGraph(render, for_init);
 	DeserializeMapForGraph(render, for_init);
 
+	if (render.graph().has_routes()) {
+		for_init.routes = DeserializeRoutes(render.graph().routes());
+	}
+
+	if (render.graph().has_hierarchy()) {
+		for_init.hierarchy = DeserializeHierarchy(render.graph().hierarchy());
+	}
+
 	return for_init;
 }
\ No newline at end of file
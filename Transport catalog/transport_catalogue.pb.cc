@@ -1,2441 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: transport_catalogue.proto
-
-#include "transport_catalogue.pb.h"
-
-#include <algorithm>
-
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/extension_set.h>
-#include <google/protobuf/wire_format_lite.h>
-#include <google/protobuf/descriptor.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/reflection_ops.h>
-#include <google/protobuf/wire_format.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Graph_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5fcatalogue_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Bus_transport_5fcatalogue_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5fcatalogue_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Coordinates_transport_5fcatalogue_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5fcatalogue_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DistanceBetweenStops_transport_5fcatalogue_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5fcatalogue_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Point_transport_5fcatalogue_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5fcatalogue_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Render_settings_transport_5fcatalogue_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5fcatalogue_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Stop_transport_5fcatalogue_2eproto;
-namespace transport_set {
-class CoordinatesDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Coordinates> _instance;
-} _Coordinates_default_instance_;
-class DistanceBetweenStopsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DistanceBetweenStops> _instance;
-} _DistanceBetweenStops_default_instance_;
-class BusDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Bus> _instance;
-} _Bus_default_instance_;
-class StopDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Stop> _instance;
-} _Stop_default_instance_;
-class PointDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Point> _instance;
-} _Point_default_instance_;
-class Render_settingsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Render_settings> _instance;
-} _Render_settings_default_instance_;
-class Transport_setDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Transport_set> _instance;
-} _Transport_set_default_instance_;
-}  // namespace transport_set
-static void InitDefaultsscc_info_Bus_transport_5fcatalogue_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transport_set::_Bus_default_instance_;
-    new (ptr) ::transport_set::Bus();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transport_set::Bus::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Bus_transport_5fcatalogue_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Bus_transport_5fcatalogue_2eproto}, {}};
-
-static void InitDefaultsscc_info_Coordinates_transport_5fcatalogue_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transport_set::_Coordinates_default_instance_;
-    new (ptr) ::transport_set::Coordinates();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transport_set::Coordinates::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Coordinates_transport_5fcatalogue_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Coordinates_transport_5fcatalogue_2eproto}, {}};
-
-static void InitDefaultsscc_info_DistanceBetweenStops_transport_5fcatalogue_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transport_set::_DistanceBetweenStops_default_instance_;
-    new (ptr) ::transport_set::DistanceBetweenStops();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transport_set::DistanceBetweenStops::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DistanceBetweenStops_transport_5fcatalogue_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_DistanceBetweenStops_transport_5fcatalogue_2eproto}, {}};
-
-static void InitDefaultsscc_info_Point_transport_5fcatalogue_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transport_set::_Point_default_instance_;
-    new (ptr) ::transport_set::Point();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transport_set::Point::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Point_transport_5fcatalogue_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Point_transport_5fcatalogue_2eproto}, {}};
-
-static void InitDefaultsscc_info_Render_settings_transport_5fcatalogue_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transport_set::_Render_settings_default_instance_;
-    new (ptr) ::transport_set::Render_settings();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transport_set::Render_settings::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Render_settings_transport_5fcatalogue_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Render_settings_transport_5fcatalogue_2eproto}, {
-      &scc_info_Point_transport_5fcatalogue_2eproto.base,}};
-
-static void InitDefaultsscc_info_Stop_transport_5fcatalogue_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transport_set::_Stop_default_instance_;
-    new (ptr) ::transport_set::Stop();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transport_set::Stop::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Stop_transport_5fcatalogue_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Stop_transport_5fcatalogue_2eproto}, {
-      &scc_info_Coordinates_transport_5fcatalogue_2eproto.base,}};
-
-static void InitDefaultsscc_info_Transport_set_transport_5fcatalogue_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transport_set::_Transport_set_default_instance_;
-    new (ptr) ::transport_set::Transport_set();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transport_set::Transport_set::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Transport_set_transport_5fcatalogue_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_Transport_set_transport_5fcatalogue_2eproto}, {
-      &scc_info_Bus_transport_5fcatalogue_2eproto.base,
-      &scc_info_Stop_transport_5fcatalogue_2eproto.base,
-      &scc_info_DistanceBetweenStops_transport_5fcatalogue_2eproto.base,
-      &scc_info_Render_settings_transport_5fcatalogue_2eproto.base,
-      &scc_info_Graph_graph_2eproto.base,}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_transport_5fcatalogue_2eproto[7];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_transport_5fcatalogue_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_transport_5fcatalogue_2eproto = nullptr;
-
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Coordinates, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Coordinates, lat_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Coordinates, lng_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::transport_set::DistanceBetweenStops, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transport_set::DistanceBetweenStops, stop_from_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::DistanceBetweenStops, stop_to_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::DistanceBetweenStops, distance_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Bus, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Bus, number_bus_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Bus, circl_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Bus, index_stops_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Stop, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Stop, name_bus_stop_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Stop, cordinates_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Point, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Point, x_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Point, y_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, width_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, height_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, padding_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, line_width_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, stop_radius_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, bus_lable_font_size_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, bus_lable_offset_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, stop_lable_font_size_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, stop_label_offset_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, underlayer_color_string_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, underlayer_width_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Render_settings, palette_string_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Transport_set, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transport_set::Transport_set, buses_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Transport_set, stops_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Transport_set, distance_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Transport_set, ren_),
-  PROTOBUF_FIELD_OFFSET(::transport_set::Transport_set, graph_),
-};
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::transport_set::Coordinates)},
-  { 7, -1, sizeof(::transport_set::DistanceBetweenStops)},
-  { 15, -1, sizeof(::transport_set::Bus)},
-  { 23, -1, sizeof(::transport_set::Stop)},
-  { 30, -1, sizeof(::transport_set::Point)},
-  { 37, -1, sizeof(::transport_set::Render_settings)},
-  { 54, -1, sizeof(::transport_set::Transport_set)},
-};
-
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transport_set::_Coordinates_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transport_set::_DistanceBetweenStops_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transport_set::_Bus_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transport_set::_Stop_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transport_set::_Point_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transport_set::_Render_settings_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transport_set::_Transport_set_default_instance_),
-};
-
-const char descriptor_table_protodef_transport_5fcatalogue_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\031transport_catalogue.proto\022\rtransport_s"
-  "et\032\013graph.proto\"\'\n\013Coordinates\022\013\n\003lat\030\001 "
-  "\001(\001\022\013\n\003lng\030\002 \001(\001\"L\n\024DistanceBetweenStops"
-  "\022\021\n\tstop_from\030\001 \001(\005\022\017\n\007stop_to\030\002 \001(\005\022\020\n\010"
-  "distance\030\003 \001(\001\"=\n\003Bus\022\022\n\nnumber_bus\030\001 \001("
-  "\t\022\r\n\005circl\030\002 \001(\010\022\023\n\013index_stops\030\003 \003(\r\"M\n"
-  "\004Stop\022\025\n\rname_bus_stop\030\001 \001(\t\022.\n\ncordinat"
-  "es\030\002 \001(\0132\032.transport_set.Coordinates\"\035\n\005"
-  "Point\022\t\n\001x\030\001 \001(\001\022\t\n\001y\030\002 \001(\001\"\331\002\n\017Render_s"
-  "ettings\022\r\n\005width\030\001 \001(\001\022\016\n\006height\030\002 \001(\001\022\017"
-  "\n\007padding\030\003 \001(\001\022\022\n\nline_width\030\004 \001(\001\022\023\n\013s"
-  "top_radius\030\005 \001(\001\022\033\n\023bus_lable_font_size\030"
-  "\006 \001(\005\022.\n\020bus_lable_offset\030\007 \001(\0132\024.transp"
-  "ort_set.Point\022\034\n\024stop_lable_font_size\030\010 "
-  "\001(\005\022/\n\021stop_label_offset\030\t \001(\0132\024.transpo"
-  "rt_set.Point\022\037\n\027underlayer_color_string\030"
-  "\n \001(\t\022\030\n\020underlayer_width\030\013 \001(\001\022\026\n\016palet"
-  "te_string\030\014 \003(\t\"\341\001\n\rTransport_set\022!\n\005bus"
-  "es\030\001 \003(\0132\022.transport_set.Bus\022\"\n\005stops\030\002 "
-  "\003(\0132\023.transport_set.Stop\0225\n\010distance\030\003 \003"
-  "(\0132#.transport_set.DistanceBetweenStops\022"
-  "+\n\003ren\030\004 \001(\0132\036.transport_set.Render_sett"
-  "ings\022%\n\005graph\030\005 \001(\0132\026.graph_serialize.Gr"
-  "aphP\000b\006proto3"
-  ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_transport_5fcatalogue_2eproto_deps[1] = {
-  &::descriptor_table_graph_2eproto,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_transport_5fcatalogue_2eproto_sccs[7] = {
-  &scc_info_Bus_transport_5fcatalogue_2eproto.base,
-  &scc_info_Coordinates_transport_5fcatalogue_2eproto.base,
-  &scc_info_DistanceBetweenStops_transport_5fcatalogue_2eproto.base,
-  &scc_info_Point_transport_5fcatalogue_2eproto.base,
-  &scc_info_Render_settings_transport_5fcatalogue_2eproto.base,
-  &scc_info_Stop_transport_5fcatalogue_2eproto.base,
-  &scc_info_Transport_set_transport_5fcatalogue_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_transport_5fcatalogue_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5fcatalogue_2eproto = {
-  false, false, descriptor_table_protodef_transport_5fcatalogue_2eproto, "transport_catalogue.proto", 933,
-  &descriptor_table_transport_5fcatalogue_2eproto_once, descriptor_table_transport_5fcatalogue_2eproto_sccs, descriptor_table_transport_5fcatalogue_2eproto_deps, 7, 1,
-  schemas, file_default_instances, TableStruct_transport_5fcatalogue_2eproto::offsets,
-  file_level_metadata_transport_5fcatalogue_2eproto, 7, file_level_enum_descriptors_transport_5fcatalogue_2eproto, file_level_service_descriptors_transport_5fcatalogue_2eproto,
-};
-
-// Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_transport_5fcatalogue_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_transport_5fcatalogue_2eproto)), true);
-namespace transport_set {
-
-// ===================================================================
-
-void Coordinates::InitAsDefaultInstance() {
-}
-class Coordinates::_Internal {
- public:
-};
-
-Coordinates::Coordinates(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:transport_set.Coordinates)
-}
-Coordinates::Coordinates(const Coordinates& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&lat_, &from.lat_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lng_) -
-    reinterpret_cast<char*>(&lat_)) + sizeof(lng_));
-  // @@protoc_insertion_point(copy_constructor:transport_set.Coordinates)
-}
-
-void Coordinates::SharedCtor() {
-  ::memset(&lat_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lng_) -
-      reinterpret_cast<char*>(&lat_)) + sizeof(lng_));
-}
-
-Coordinates::~Coordinates() {
-  // @@protoc_insertion_point(destructor:transport_set.Coordinates)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Coordinates::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void Coordinates::ArenaDtor(void* object) {
-  Coordinates* _this = reinterpret_cast< Coordinates* >(object);
-  (void)_this;
-}
-void Coordinates::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Coordinates::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Coordinates& Coordinates::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Coordinates_transport_5fcatalogue_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Coordinates::Clear() {
-// @@protoc_insertion_point(message_clear_start:transport_set.Coordinates)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&lat_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lng_) -
-      reinterpret_cast<char*>(&lat_)) + sizeof(lng_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Coordinates::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // double lat = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // double lng = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
-          lng_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Coordinates::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transport_set.Coordinates)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double lat = 1;
-  if (!(this->lat() <= 0 && this->lat() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_lat(), target);
-  }
-
-  // double lng = 2;
-  if (!(this->lng() <= 0 && this->lng() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_lng(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:transport_set.Coordinates)
-  return target;
-}
-
-size_t Coordinates::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transport_set.Coordinates)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // double lat = 1;
-  if (!(this->lat() <= 0 && this->lat() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  // double lng = 2;
-  if (!(this->lng() <= 0 && this->lng() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Coordinates::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transport_set.Coordinates)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Coordinates* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Coordinates>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transport_set.Coordinates)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transport_set.Coordinates)
-    MergeFrom(*source);
-  }
-}
-
-void Coordinates::MergeFrom(const Coordinates& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transport_set.Coordinates)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!(from.lat() <= 0 && from.lat() >= 0)) {
-    _internal_set_lat(from._internal_lat());
-  }
-  if (!(from.lng() <= 0 && from.lng() >= 0)) {
-    _internal_set_lng(from._internal_lng());
-  }
-}
-
-void Coordinates::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transport_set.Coordinates)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Coordinates::CopyFrom(const Coordinates& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transport_set.Coordinates)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Coordinates::IsInitialized() const {
-  return true;
-}
-
-void Coordinates::InternalSwap(Coordinates* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Coordinates, lng_)
-      + sizeof(Coordinates::lng_)
-      - PROTOBUF_FIELD_OFFSET(Coordinates, lat_)>(
-          reinterpret_cast<char*>(&lat_),
-          reinterpret_cast<char*>(&other->lat_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Coordinates::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void DistanceBetweenStops::InitAsDefaultInstance() {
-}
-class DistanceBetweenStops::_Internal {
- public:
-};
-
-DistanceBetweenStops::DistanceBetweenStops(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:transport_set.DistanceBetweenStops)
-}
-DistanceBetweenStops::DistanceBetweenStops(const DistanceBetweenStops& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&stop_from_, &from.stop_from_,
-    static_cast<size_t>(reinterpret_cast<char*>(&distance_) -
-    reinterpret_cast<char*>(&stop_from_)) + sizeof(distance_));
-  // @@protoc_insertion_point(copy_constructor:transport_set.DistanceBetweenStops)
-}
-
-void DistanceBetweenStops::SharedCtor() {
-  ::memset(&stop_from_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&distance_) -
-      reinterpret_cast<char*>(&stop_from_)) + sizeof(distance_));
-}
-
-DistanceBetweenStops::~DistanceBetweenStops() {
-  // @@protoc_insertion_point(destructor:transport_set.DistanceBetweenStops)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void DistanceBetweenStops::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void DistanceBetweenStops::ArenaDtor(void* object) {
-  DistanceBetweenStops* _this = reinterpret_cast< DistanceBetweenStops* >(object);
-  (void)_this;
-}
-void DistanceBetweenStops::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void DistanceBetweenStops::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DistanceBetweenStops& DistanceBetweenStops::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DistanceBetweenStops_transport_5fcatalogue_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void DistanceBetweenStops::Clear() {
-// @@protoc_insertion_point(message_clear_start:transport_set.DistanceBetweenStops)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&stop_from_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&distance_) -
-      reinterpret_cast<char*>(&stop_from_)) + sizeof(distance_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* DistanceBetweenStops::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // int32 stop_from = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          stop_from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 stop_to = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          stop_to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // double distance = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25)) {
-          distance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* DistanceBetweenStops::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transport_set.DistanceBetweenStops)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 stop_from = 1;
-  if (this->stop_from() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_stop_from(), target);
-  }
-
-  // int32 stop_to = 2;
-  if (this->stop_to() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_stop_to(), target);
-  }
-
-  // double distance = 3;
-  if (!(this->distance() <= 0 && this->distance() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_distance(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:transport_set.DistanceBetweenStops)
-  return target;
-}
-
-size_t DistanceBetweenStops::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transport_set.DistanceBetweenStops)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // int32 stop_from = 1;
-  if (this->stop_from() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_stop_from());
-  }
-
-  // int32 stop_to = 2;
-  if (this->stop_to() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_stop_to());
-  }
-
-  // double distance = 3;
-  if (!(this->distance() <= 0 && this->distance() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void DistanceBetweenStops::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transport_set.DistanceBetweenStops)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DistanceBetweenStops* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DistanceBetweenStops>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transport_set.DistanceBetweenStops)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transport_set.DistanceBetweenStops)
-    MergeFrom(*source);
-  }
-}
-
-void DistanceBetweenStops::MergeFrom(const DistanceBetweenStops& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transport_set.DistanceBetweenStops)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.stop_from() != 0) {
-    _internal_set_stop_from(from._internal_stop_from());
-  }
-  if (from.stop_to() != 0) {
-    _internal_set_stop_to(from._internal_stop_to());
-  }
-  if (!(from.distance() <= 0 && from.distance() >= 0)) {
-    _internal_set_distance(from._internal_distance());
-  }
-}
-
-void DistanceBetweenStops::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transport_set.DistanceBetweenStops)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void DistanceBetweenStops::CopyFrom(const DistanceBetweenStops& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transport_set.DistanceBetweenStops)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool DistanceBetweenStops::IsInitialized() const {
-  return true;
-}
-
-void DistanceBetweenStops::InternalSwap(DistanceBetweenStops* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(DistanceBetweenStops, distance_)
-      + sizeof(DistanceBetweenStops::distance_)
-      - PROTOBUF_FIELD_OFFSET(DistanceBetweenStops, stop_from_)>(
-          reinterpret_cast<char*>(&stop_from_),
-          reinterpret_cast<char*>(&other->stop_from_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata DistanceBetweenStops::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Bus::InitAsDefaultInstance() {
-}
-class Bus::_Internal {
- public:
-};
-
-Bus::Bus(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  index_stops_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:transport_set.Bus)
-}
-Bus::Bus(const Bus& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      index_stops_(from.index_stops_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  number_bus_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_number_bus().empty()) {
-    number_bus_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_number_bus(),
-      GetArena());
-  }
-  circl_ = from.circl_;
-  // @@protoc_insertion_point(copy_constructor:transport_set.Bus)
-}
-
-void Bus::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Bus_transport_5fcatalogue_2eproto.base);
-  number_bus_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  circl_ = false;
-}
-
-Bus::~Bus() {
-  // @@protoc_insertion_point(destructor:transport_set.Bus)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Bus::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  number_bus_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-
-void Bus::ArenaDtor(void* object) {
-  Bus* _this = reinterpret_cast< Bus* >(object);
-  (void)_this;
-}
-void Bus::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Bus::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Bus& Bus::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Bus_transport_5fcatalogue_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Bus::Clear() {
-// @@protoc_insertion_point(message_clear_start:transport_set.Bus)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  index_stops_.Clear();
-  number_bus_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  circl_ = false;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Bus::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // string number_bus = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_number_bus();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "transport_set.Bus.number_bus"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bool circl = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          circl_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated uint32 index_stops = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_index_stops(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24) {
-          _internal_add_index_stops(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Bus::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transport_set.Bus)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string number_bus = 1;
-  if (this->number_bus().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_number_bus().data(), static_cast<int>(this->_internal_number_bus().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transport_set.Bus.number_bus");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_number_bus(), target);
-  }
-
-  // bool circl = 2;
-  if (this->circl() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_circl(), target);
-  }
-
-  // repeated uint32 index_stops = 3;
-  {
-    int byte_size = _index_stops_cached_byte_size_.load(std::memory_order_relaxed);
-    if (byte_size > 0) {
-      target = stream->WriteUInt32Packed(
-          3, _internal_index_stops(), byte_size, target);
-    }
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:transport_set.Bus)
-  return target;
-}
-
-size_t Bus::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transport_set.Bus)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated uint32 index_stops = 3;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->index_stops_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
-    }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _index_stops_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
-  }
-
-  // string number_bus = 1;
-  if (this->number_bus().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_number_bus());
-  }
-
-  // bool circl = 2;
-  if (this->circl() != 0) {
-    total_size += 1 + 1;
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Bus::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transport_set.Bus)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Bus* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Bus>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transport_set.Bus)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transport_set.Bus)
-    MergeFrom(*source);
-  }
-}
-
-void Bus::MergeFrom(const Bus& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transport_set.Bus)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  index_stops_.MergeFrom(from.index_stops_);
-  if (from.number_bus().size() > 0) {
-    _internal_set_number_bus(from._internal_number_bus());
-  }
-  if (from.circl() != 0) {
-    _internal_set_circl(from._internal_circl());
-  }
-}
-
-void Bus::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transport_set.Bus)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Bus::CopyFrom(const Bus& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transport_set.Bus)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Bus::IsInitialized() const {
-  return true;
-}
-
-void Bus::InternalSwap(Bus* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  index_stops_.InternalSwap(&other->index_stops_);
-  number_bus_.Swap(&other->number_bus_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(circl_, other->circl_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Bus::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Stop::InitAsDefaultInstance() {
-  ::transport_set::_Stop_default_instance_._instance.get_mutable()->cordinates_ = const_cast< ::transport_set::Coordinates*>(
-      ::transport_set::Coordinates::internal_default_instance());
-}
-class Stop::_Internal {
- public:
-  static const ::transport_set::Coordinates& cordinates(const Stop* msg);
-};
-
-const ::transport_set::Coordinates&
-Stop::_Internal::cordinates(const Stop* msg) {
-  return *msg->cordinates_;
-}
-Stop::Stop(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:transport_set.Stop)
-}
-Stop::Stop(const Stop& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_bus_stop_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_name_bus_stop().empty()) {
-    name_bus_stop_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_name_bus_stop(),
-      GetArena());
-  }
-  if (from._internal_has_cordinates()) {
-    cordinates_ = new ::transport_set::Coordinates(*from.cordinates_);
-  } else {
-    cordinates_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:transport_set.Stop)
-}
-
-void Stop::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Stop_transport_5fcatalogue_2eproto.base);
-  name_bus_stop_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  cordinates_ = nullptr;
-}
-
-Stop::~Stop() {
-  // @@protoc_insertion_point(destructor:transport_set.Stop)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Stop::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_bus_stop_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete cordinates_;
-}
-
-void Stop::ArenaDtor(void* object) {
-  Stop* _this = reinterpret_cast< Stop* >(object);
-  (void)_this;
-}
-void Stop::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Stop::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Stop& Stop::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Stop_transport_5fcatalogue_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Stop::Clear() {
-// @@protoc_insertion_point(message_clear_start:transport_set.Stop)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  name_bus_stop_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && cordinates_ != nullptr) {
-    delete cordinates_;
-  }
-  cordinates_ = nullptr;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Stop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // string name_bus_stop = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name_bus_stop();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "transport_set.Stop.name_bus_stop"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .transport_set.Coordinates cordinates = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_cordinates(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Stop::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transport_set.Stop)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name_bus_stop = 1;
-  if (this->name_bus_stop().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name_bus_stop().data(), static_cast<int>(this->_internal_name_bus_stop().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transport_set.Stop.name_bus_stop");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_name_bus_stop(), target);
-  }
-
-  // .transport_set.Coordinates cordinates = 2;
-  if (this->has_cordinates()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::cordinates(this), target, stream);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:transport_set.Stop)
-  return target;
-}
-
-size_t Stop::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transport_set.Stop)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string name_bus_stop = 1;
-  if (this->name_bus_stop().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name_bus_stop());
-  }
-
-  // .transport_set.Coordinates cordinates = 2;
-  if (this->has_cordinates()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *cordinates_);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Stop::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transport_set.Stop)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Stop* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Stop>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transport_set.Stop)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transport_set.Stop)
-    MergeFrom(*source);
-  }
-}
-
-void Stop::MergeFrom(const Stop& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transport_set.Stop)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.name_bus_stop().size() > 0) {
-    _internal_set_name_bus_stop(from._internal_name_bus_stop());
-  }
-  if (from.has_cordinates()) {
-    _internal_mutable_cordinates()->::transport_set::Coordinates::MergeFrom(from._internal_cordinates());
-  }
-}
-
-void Stop::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transport_set.Stop)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Stop::CopyFrom(const Stop& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transport_set.Stop)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Stop::IsInitialized() const {
-  return true;
-}
-
-void Stop::InternalSwap(Stop* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  name_bus_stop_.Swap(&other->name_bus_stop_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(cordinates_, other->cordinates_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Stop::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Point::InitAsDefaultInstance() {
-}
-class Point::_Internal {
- public:
-};
-
-Point::Point(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:transport_set.Point)
-}
-Point::Point(const Point& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&y_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(y_));
-  // @@protoc_insertion_point(copy_constructor:transport_set.Point)
-}
-
-void Point::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&y_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(y_));
-}
-
-Point::~Point() {
-  // @@protoc_insertion_point(destructor:transport_set.Point)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Point::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void Point::ArenaDtor(void* object) {
-  Point* _this = reinterpret_cast< Point* >(object);
-  (void)_this;
-}
-void Point::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Point::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Point& Point::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Point_transport_5fcatalogue_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Point::Clear() {
-// @@protoc_insertion_point(message_clear_start:transport_set.Point)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&y_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(y_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Point::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // double x = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // double y = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
-          y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Point::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transport_set.Point)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_x(), target);
-  }
-
-  // double y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_y(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:transport_set.Point)
-  return target;
-}
-
-size_t Point::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transport_set.Point)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // double x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  // double y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Point::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transport_set.Point)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Point* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Point>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transport_set.Point)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transport_set.Point)
-    MergeFrom(*source);
-  }
-}
-
-void Point::MergeFrom(const Point& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transport_set.Point)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!(from.x() <= 0 && from.x() >= 0)) {
-    _internal_set_x(from._internal_x());
-  }
-  if (!(from.y() <= 0 && from.y() >= 0)) {
-    _internal_set_y(from._internal_y());
-  }
-}
-
-void Point::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transport_set.Point)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Point::CopyFrom(const Point& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transport_set.Point)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Point::IsInitialized() const {
-  return true;
-}
-
-void Point::InternalSwap(Point* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Point, y_)
-      + sizeof(Point::y_)
-      - PROTOBUF_FIELD_OFFSET(Point, x_)>(
-          reinterpret_cast<char*>(&x_),
-          reinterpret_cast<char*>(&other->x_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Point::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Render_settings::InitAsDefaultInstance() {
-  ::transport_set::_Render_settings_default_instance_._instance.get_mutable()->bus_lable_offset_ = const_cast< ::transport_set::Point*>(
-      ::transport_set::Point::internal_default_instance());
-  ::transport_set::_Render_settings_default_instance_._instance.get_mutable()->stop_label_offset_ = const_cast< ::transport_set::Point*>(
-      ::transport_set::Point::internal_default_instance());
-}
-class Render_settings::_Internal {
- public:
-  static const ::transport_set::Point& bus_lable_offset(const Render_settings* msg);
-  static const ::transport_set::Point& stop_label_offset(const Render_settings* msg);
-};
-
-const ::transport_set::Point&
-Render_settings::_Internal::bus_lable_offset(const Render_settings* msg) {
-  return *msg->bus_lable_offset_;
-}
-const ::transport_set::Point&
-Render_settings::_Internal::stop_label_offset(const Render_settings* msg) {
-  return *msg->stop_label_offset_;
-}
-Render_settings::Render_settings(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  palette_string_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:transport_set.Render_settings)
-}
-Render_settings::Render_settings(const Render_settings& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      palette_string_(from.palette_string_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  underlayer_color_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_underlayer_color_string().empty()) {
-    underlayer_color_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_underlayer_color_string(),
-      GetArena());
-  }
-  if (from._internal_has_bus_lable_offset()) {
-    bus_lable_offset_ = new ::transport_set::Point(*from.bus_lable_offset_);
-  } else {
-    bus_lable_offset_ = nullptr;
-  }
-  if (from._internal_has_stop_label_offset()) {
-    stop_label_offset_ = new ::transport_set::Point(*from.stop_label_offset_);
-  } else {
-    stop_label_offset_ = nullptr;
-  }
-  ::memcpy(&width_, &from.width_,
-    static_cast<size_t>(reinterpret_cast<char*>(&underlayer_width_) -
-    reinterpret_cast<char*>(&width_)) + sizeof(underlayer_width_));
-  // @@protoc_insertion_point(copy_constructor:transport_set.Render_settings)
-}
-
-void Render_settings::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Render_settings_transport_5fcatalogue_2eproto.base);
-  underlayer_color_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&bus_lable_offset_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&underlayer_width_) -
-      reinterpret_cast<char*>(&bus_lable_offset_)) + sizeof(underlayer_width_));
-}
-
-Render_settings::~Render_settings() {
-  // @@protoc_insertion_point(destructor:transport_set.Render_settings)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Render_settings::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  underlayer_color_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete bus_lable_offset_;
-  if (this != internal_default_instance()) delete stop_label_offset_;
-}
-
-void Render_settings::ArenaDtor(void* object) {
-  Render_settings* _this = reinterpret_cast< Render_settings* >(object);
-  (void)_this;
-}
-void Render_settings::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Render_settings::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Render_settings& Render_settings::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Render_settings_transport_5fcatalogue_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Render_settings::Clear() {
-// @@protoc_insertion_point(message_clear_start:transport_set.Render_settings)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  palette_string_.Clear();
-  underlayer_color_string_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && bus_lable_offset_ != nullptr) {
-    delete bus_lable_offset_;
-  }
-  bus_lable_offset_ = nullptr;
-  if (GetArena() == nullptr && stop_label_offset_ != nullptr) {
-    delete stop_label_offset_;
-  }
-  stop_label_offset_ = nullptr;
-  ::memset(&width_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&underlayer_width_) -
-      reinterpret_cast<char*>(&width_)) + sizeof(underlayer_width_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Render_settings::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // double width = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // double height = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
-          height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // double padding = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25)) {
-          padding_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // double line_width = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 33)) {
-          line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // double stop_radius = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 41)) {
-          stop_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // int32 bus_lable_font_size = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          bus_lable_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .transport_set.Point bus_lable_offset = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
-          ptr = ctx->ParseMessage(_internal_mutable_bus_lable_offset(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 stop_lable_font_size = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
-          stop_lable_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .transport_set.Point stop_label_offset = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
-          ptr = ctx->ParseMessage(_internal_mutable_stop_label_offset(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string underlayer_color_string = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
-          auto str = _internal_mutable_underlayer_color_string();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "transport_set.Render_settings.underlayer_color_string"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // double underlayer_width = 11;
-      case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 89)) {
-          underlayer_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      // repeated string palette_string = 12;
-      case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_palette_string();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "transport_set.Render_settings.palette_string"));
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Render_settings::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transport_set.Render_settings)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double width = 1;
-  if (!(this->width() <= 0 && this->width() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_width(), target);
-  }
-
-  // double height = 2;
-  if (!(this->height() <= 0 && this->height() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_height(), target);
-  }
-
-  // double padding = 3;
-  if (!(this->padding() <= 0 && this->padding() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_padding(), target);
-  }
-
-  // double line_width = 4;
-  if (!(this->line_width() <= 0 && this->line_width() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(4, this->_internal_line_width(), target);
-  }
-
-  // double stop_radius = 5;
-  if (!(this->stop_radius() <= 0 && this->stop_radius() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(5, this->_internal_stop_radius(), target);
-  }
-
-  // int32 bus_lable_font_size = 6;
-  if (this->bus_lable_font_size() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_bus_lable_font_size(), target);
-  }
-
-  // .transport_set.Point bus_lable_offset = 7;
-  if (this->has_bus_lable_offset()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        7, _Internal::bus_lable_offset(this), target, stream);
-  }
-
-  // int32 stop_lable_font_size = 8;
-  if (this->stop_lable_font_size() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(8, this->_internal_stop_lable_font_size(), target);
-  }
-
-  // .transport_set.Point stop_label_offset = 9;
-  if (this->has_stop_label_offset()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        9, _Internal::stop_label_offset(this), target, stream);
-  }
-
-  // string underlayer_color_string = 10;
-  if (this->underlayer_color_string().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_underlayer_color_string().data(), static_cast<int>(this->_internal_underlayer_color_string().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transport_set.Render_settings.underlayer_color_string");
-    target = stream->WriteStringMaybeAliased(
-        10, this->_internal_underlayer_color_string(), target);
-  }
-
-  // double underlayer_width = 11;
-  if (!(this->underlayer_width() <= 0 && this->underlayer_width() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(11, this->_internal_underlayer_width(), target);
-  }
-
-  // repeated string palette_string = 12;
-  for (int i = 0, n = this->_internal_palette_string_size(); i < n; i++) {
-    const auto& s = this->_internal_palette_string(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transport_set.Render_settings.palette_string");
-    target = stream->WriteString(12, s, target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:transport_set.Render_settings)
-  return target;
-}
-
-size_t Render_settings::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transport_set.Render_settings)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated string palette_string = 12;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(palette_string_.size());
-  for (int i = 0, n = palette_string_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      palette_string_.Get(i));
-  }
-
-  // string underlayer_color_string = 10;
-  if (this->underlayer_color_string().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_underlayer_color_string());
-  }
-
-  // .transport_set.Point bus_lable_offset = 7;
-  if (this->has_bus_lable_offset()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bus_lable_offset_);
-  }
-
-  // .transport_set.Point stop_label_offset = 9;
-  if (this->has_stop_label_offset()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *stop_label_offset_);
-  }
-
-  // double width = 1;
-  if (!(this->width() <= 0 && this->width() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  // double height = 2;
-  if (!(this->height() <= 0 && this->height() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  // double padding = 3;
-  if (!(this->padding() <= 0 && this->padding() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  // double line_width = 4;
-  if (!(this->line_width() <= 0 && this->line_width() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  // double stop_radius = 5;
-  if (!(this->stop_radius() <= 0 && this->stop_radius() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  // int32 bus_lable_font_size = 6;
-  if (this->bus_lable_font_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_bus_lable_font_size());
-  }
-
-  // int32 stop_lable_font_size = 8;
-  if (this->stop_lable_font_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_stop_lable_font_size());
-  }
-
-  // double underlayer_width = 11;
-  if (!(this->underlayer_width() <= 0 && this->underlayer_width() >= 0)) {
-    total_size += 1 + 8;
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Render_settings::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transport_set.Render_settings)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Render_settings* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Render_settings>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transport_set.Render_settings)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transport_set.Render_settings)
-    MergeFrom(*source);
-  }
-}
-
-void Render_settings::MergeFrom(const Render_settings& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transport_set.Render_settings)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  palette_string_.MergeFrom(from.palette_string_);
-  if (from.underlayer_color_string().size() > 0) {
-    _internal_set_underlayer_color_string(from._internal_underlayer_color_string());
-  }
-  if (from.has_bus_lable_offset()) {
-    _internal_mutable_bus_lable_offset()->::transport_set::Point::MergeFrom(from._internal_bus_lable_offset());
-  }
-  if (from.has_stop_label_offset()) {
-    _internal_mutable_stop_label_offset()->::transport_set::Point::MergeFrom(from._internal_stop_label_offset());
-  }
-  if (!(from.width() <= 0 && from.width() >= 0)) {
-    _internal_set_width(from._internal_width());
-  }
-  if (!(from.height() <= 0 && from.height() >= 0)) {
-    _internal_set_height(from._internal_height());
-  }
-  if (!(from.padding() <= 0 && from.padding() >= 0)) {
-    _internal_set_padding(from._internal_padding());
-  }
-  if (!(from.line_width() <= 0 && from.line_width() >= 0)) {
-    _internal_set_line_width(from._internal_line_width());
-  }
-  if (!(from.stop_radius() <= 0 && from.stop_radius() >= 0)) {
-    _internal_set_stop_radius(from._internal_stop_radius());
-  }
-  if (from.bus_lable_font_size() != 0) {
-    _internal_set_bus_lable_font_size(from._internal_bus_lable_font_size());
-  }
-  if (from.stop_lable_font_size() != 0) {
-    _internal_set_stop_lable_font_size(from._internal_stop_lable_font_size());
-  }
-  if (!(from.underlayer_width() <= 0 && from.underlayer_width() >= 0)) {
-    _internal_set_underlayer_width(from._internal_underlayer_width());
-  }
-}
-
-void Render_settings::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transport_set.Render_settings)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Render_settings::CopyFrom(const Render_settings& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transport_set.Render_settings)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Render_settings::IsInitialized() const {
-  return true;
-}
-
-void Render_settings::InternalSwap(Render_settings* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  palette_string_.InternalSwap(&other->palette_string_);
-  underlayer_color_string_.Swap(&other->underlayer_color_string_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Render_settings, underlayer_width_)
-      + sizeof(Render_settings::underlayer_width_)
-      - PROTOBUF_FIELD_OFFSET(Render_settings, bus_lable_offset_)>(
-          reinterpret_cast<char*>(&bus_lable_offset_),
-          reinterpret_cast<char*>(&other->bus_lable_offset_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Render_settings::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Transport_set::InitAsDefaultInstance() {
-  ::transport_set::_Transport_set_default_instance_._instance.get_mutable()->ren_ = const_cast< ::transport_set::Render_settings*>(
-      ::transport_set::Render_settings::internal_default_instance());
-  ::transport_set::_Transport_set_default_instance_._instance.get_mutable()->graph_ = const_cast< ::graph_serialize::Graph*>(
-      ::graph_serialize::Graph::internal_default_instance());
-}
-class Transport_set::_Internal {
- public:
-  static const ::transport_set::Render_settings& ren(const Transport_set* msg);
-  static const ::graph_serialize::Graph& graph(const Transport_set* msg);
-};
-
-const ::transport_set::Render_settings&
-Transport_set::_Internal::ren(const Transport_set* msg) {
-  return *msg->ren_;
-}
-const ::graph_serialize::Graph&
-Transport_set::_Internal::graph(const Transport_set* msg) {
-  return *msg->graph_;
-}
-void Transport_set::clear_graph() {
-  if (GetArena() == nullptr && graph_ != nullptr) {
-    delete graph_;
-  }
-  graph_ = nullptr;
-}
-Transport_set::Transport_set(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  buses_(arena),
-  stops_(arena),
-  distance_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:transport_set.Transport_set)
-}
-Transport_set::Transport_set(const Transport_set& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      buses_(from.buses_),
-      stops_(from.stops_),
-      distance_(from.distance_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_ren()) {
-    ren_ = new ::transport_set::Render_settings(*from.ren_);
-  } else {
-    ren_ = nullptr;
-  }
-  if (from._internal_has_graph()) {
-    graph_ = new ::graph_serialize::Graph(*from.graph_);
-  } else {
-    graph_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:transport_set.Transport_set)
-}
-
-void Transport_set::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Transport_set_transport_5fcatalogue_2eproto.base);
-  ::memset(&ren_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&graph_) -
-      reinterpret_cast<char*>(&ren_)) + sizeof(graph_));
-}
-
-Transport_set::~Transport_set() {
-  // @@protoc_insertion_point(destructor:transport_set.Transport_set)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Transport_set::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete ren_;
-  if (this != internal_default_instance()) delete graph_;
-}
-
-void Transport_set::ArenaDtor(void* object) {
-  Transport_set* _this = reinterpret_cast< Transport_set* >(object);
-  (void)_this;
-}
-void Transport_set::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Transport_set::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Transport_set& Transport_set::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Transport_set_transport_5fcatalogue_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Transport_set::Clear() {
-// @@protoc_insertion_point(message_clear_start:transport_set.Transport_set)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  buses_.Clear();
-  stops_.Clear();
-  distance_.Clear();
-  if (GetArena() == nullptr && ren_ != nullptr) {
-    delete ren_;
-  }
-  ren_ = nullptr;
-  if (GetArena() == nullptr && graph_ != nullptr) {
-    delete graph_;
-  }
-  graph_ = nullptr;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Transport_set::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // repeated .transport_set.Bus buses = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_buses(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // repeated .transport_set.Stop stops = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_stops(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // repeated .transport_set.DistanceBetweenStops distance = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_distance(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // .transport_set.Render_settings ren = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_ren(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .graph_serialize.Graph graph = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_graph(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Transport_set::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transport_set.Transport_set)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .transport_set.Bus buses = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_buses_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_buses(i), target, stream);
-  }
-
-  // repeated .transport_set.Stop stops = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_stops_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_stops(i), target, stream);
-  }
-
-  // repeated .transport_set.DistanceBetweenStops distance = 3;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_distance_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, this->_internal_distance(i), target, stream);
-  }
-
-  // .transport_set.Render_settings ren = 4;
-  if (this->has_ren()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::ren(this), target, stream);
-  }
-
-  // .graph_serialize.Graph graph = 5;
-  if (this->has_graph()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::graph(this), target, stream);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:transport_set.Transport_set)
-  return target;
-}
-
-size_t Transport_set::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transport_set.Transport_set)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated .transport_set.Bus buses = 1;
-  total_size += 1UL * this->_internal_buses_size();
-  for (const auto& msg : this->buses_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // repeated .transport_set.Stop stops = 2;
-  total_size += 1UL * this->_internal_stops_size();
-  for (const auto& msg : this->stops_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // repeated .transport_set.DistanceBetweenStops distance = 3;
-  total_size += 1UL * this->_internal_distance_size();
-  for (const auto& msg : this->distance_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // .transport_set.Render_settings ren = 4;
-  if (this->has_ren()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *ren_);
-  }
-
-  // .graph_serialize.Graph graph = 5;
-  if (this->has_graph()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *graph_);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Transport_set::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transport_set.Transport_set)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Transport_set* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Transport_set>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transport_set.Transport_set)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transport_set.Transport_set)
-    MergeFrom(*source);
-  }
-}
-
-void Transport_set::MergeFrom(const Transport_set& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transport_set.Transport_set)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  buses_.MergeFrom(from.buses_);
-  stops_.MergeFrom(from.stops_);
-  distance_.MergeFrom(from.distance_);
-  if (from.has_ren()) {
-    _internal_mutable_ren()->::transport_set::Render_settings::MergeFrom(from._internal_ren());
-  }
-  if (from.has_graph()) {
-    _internal_mutable_graph()->::graph_serialize::Graph::MergeFrom(from._internal_graph());
-  }
-}
-
-void Transport_set::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transport_set.Transport_set)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Transport_set::CopyFrom(const Transport_set& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transport_set.Transport_set)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Transport_set::IsInitialized() const {
-  return true;
-}
-
-void Transport_set::InternalSwap(Transport_set* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  buses_.InternalSwap(&other->buses_);
-  stops_.InternalSwap(&other->stops_);
-  distance_.InternalSwap(&other->distance_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Transport_set, graph_)
-      + sizeof(Transport_set::graph_)
-      - PROTOBUF_FIELD_OFFSET(Transport_set, ren_)>(
-          reinterpret_cast<char*>(&ren_),
-          reinterpret_cast<char*>(&other->ren_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Transport_set::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace transport_set
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::transport_set::Coordinates* Arena::CreateMaybeMessage< ::transport_set::Coordinates >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::transport_set::Coordinates >(arena);
-}
-template<> PROTOBUF_NOINLINE ::transport_set::DistanceBetweenStops* Arena::CreateMaybeMessage< ::transport_set::DistanceBetweenStops >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::transport_set::DistanceBetweenStops >(arena);
-}
-template<> PROTOBUF_NOINLINE ::transport_set::Bus* Arena::CreateMaybeMessage< ::transport_set::Bus >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::transport_set::Bus >(arena);
-}
-template<> PROTOBUF_NOINLINE ::transport_set::Stop* Arena::CreateMaybeMessage< ::transport_set::Stop >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::transport_set::Stop >(arena);
-}
-template<> PROTOBUF_NOINLINE ::transport_set::Point* Arena::CreateMaybeMessage< ::transport_set::Point >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::transport_set::Point >(arena);
-}
-template<> PROTOBUF_NOINLINE ::transport_set::Render_settings* Arena::CreateMaybeMessage< ::transport_set::Render_settings >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::transport_set::Render_settings >(arena);
-}
-template<> PROTOBUF_NOINLINE ::transport_set::Transport_set* Arena::CreateMaybeMessage< ::transport_set::Transport_set >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::transport_set::Transport_set >(arena);
-}
-PROTOBUF_NAMESPACE_CLOSE
-
-// @@protoc_insertion_point(global_scope)
-#include <google/protobuf/port_undef.inc>
@@ -5,10 +5,14 @@ namespace transport_router {
     using namespace detail;
 
     InitGraph::InitGraph(transport_catalogue::TransportCatalogue& catalog, detail::InputSerialization&& ser) : catalog_(catalog),
-        graph_(std::move(ser.edges), std::move(ser.incidence_lists)),
+        graph_(std::move(ser.graph)),
         vertex_to_name_(std::move(ser.vertex_to_name)),
         name_to_vertex_(std::move(ser.name_to_vertex)),
-        edge_info_(std::move(ser.edge_info)) {}
+        edge_info_(std::move(ser.edge_info)),
+        routes_(std::move(ser.routes)),
+        hierarchy_(std::move(ser.hierarchy)) {
+        graph_.Freeze();
+    }
 
     void InitGraph::InfoForGraph(const InformationForCatalog& queries) {
         using namespace std;
@@ -28,6 +32,8 @@ namespace transport_router {
             }
         }
 
+        graph_.Freeze();
+
     }
 
     void InitGraph::CreatePointStops(const std::vector<transport_catalogue::detail::BusStop>& stops, double bus_wait_time) {
@@ -84,6 +90,14 @@ namespace transport_router {
         return edge_info_;
     }
 
+    const std::optional<graph::RoutingTable<double>>& InitGraph::GetRoutingTable() const {
+        return routes_;
+    }
+
+    const std::optional<graph::ContractionHierarchy<double>>& InitGraph::GetContractionHierarchy() const {
+        return hierarchy_;
+    }
+
     void InitGraph::SetVertexToName(
         std::unordered_map<size_t, std::string>&& other) {
         vertex_to_name_ = std::move(other);
@@ -99,12 +113,29 @@ namespace transport_router {
         edge_info_ = std::move(other);
     }
 
+    namespace {
+
+        std::variant<graph::DijkstraRouter<double>, graph::TableRouter<double>, graph::HierarchyRouter<double>>
+            MakeRouter(const InitGraph& catalog) {
+            if (catalog.GetRoutingTable()) {
+                return graph::TableRouter<double>(catalog.GetGraph(), *catalog.GetRoutingTable());
+            }
+            if (catalog.GetContractionHierarchy()) {
+                return graph::HierarchyRouter<double>(catalog.GetGraph(), *catalog.GetContractionHierarchy());
+            }
+            return graph::DijkstraRouter<double>(catalog.GetGraph());
+        }
+    }
+
+    TransportRouter::TransportRouter(InitGraph& catalog) : catalog_(catalog), router_(MakeRouter(catalog_)) {
+    }
+
     std::optional<BuildRoute> TransportRouter::GetItemsRoute(const std::string& from_str, const std::string& to_str) const {
 
         const size_t from = catalog_.GetVertex(from_str).begin;
         const size_t to = catalog_.GetVertex(to_str).begin;
 
-        auto way = std::move(router_.BuildRoute(from, to));
+        auto way = std::visit([from, to](const auto& router) { return router.BuildRoute(from, to); }, router_);
 
         if (!way.has_value()) return std::nullopt;
 
@@ -113,7 +144,7 @@ namespace transport_router {
 
         for (int i = 0; i < static_cast<int>((*way).edges.size()); i++) {
 
-            const graph::Edge<double>& info = catalog_.GetGraph().GetEdge((*way).edges.at(i));
+            const graph::Edge<double> info = catalog_.GetGraph().GetEdge((*way).edges.at(i));
 
             if (catalog_.GetNameStop(info.from) == catalog_.GetNameStop(info.to)) {
                 ItemRoute new_item_stop;
@@ -2,12 +2,15 @@
 
 #include "graph.h"
 #include "router.h"
+#include "routing_table.h"
+#include "contraction_hierarchy.h"
 #include "transport_catalogue.h"
 #include "domain.h"
 
 #include <map>
 #include <vector>
 #include <optional>
+#include <variant>
 
 namespace transport_router {
 
@@ -37,11 +40,12 @@ namespace transport_router {
 		};
 
 		struct InputSerialization {
-			std::vector<graph::Edge<double>> edges;
-			std::vector<std::vector<size_t>> incidence_lists;
+			graph::DirectedWeightedGraph<double> graph;
 			std::unordered_map<size_t, std::string> vertex_to_name;
 			std::unordered_map<std::string, detail::VertexBeginAndEnd, std::hash<std::string>> name_to_vertex;
 			std::unordered_map<size_t, detail::EdgeForGraph> edge_info;
+			std::optional<graph::RoutingTable<double>> routes;
+			std::optional<graph::ContractionHierarchy<double>> hierarchy;
 		};
 	}
 
@@ -74,6 +78,12 @@ namespace transport_router {
 
 		const std::unordered_map<size_t, detail::EdgeForGraph>& GetEdgeInfo() const;
 
+		// Есть только у графа из базы, собранной с precompute_routes
+		const std::optional<graph::RoutingTable<double>>& GetRoutingTable() const;
+
+		// Есть только у графа из базы, собранной с contraction_hierarchy
+		const std::optional<graph::ContractionHierarchy<double>>& GetContractionHierarchy() const;
+
 		void SetVertexToName(std::unordered_map<size_t, std::string>&& other);
 
 		void SetNameToVertex(
@@ -87,6 +97,8 @@ namespace transport_router {
 		std::unordered_map<size_t, std::string> vertex_to_name_;
 		std::unordered_map<std::string, detail::VertexBeginAndEnd, std::hash<std::string>> name_to_vertex_;
 		std::unordered_map<size_t, detail::EdgeForGraph> edge_info_;
+		std::optional<graph::RoutingTable<double>> routes_;
+		std::optional<graph::ContractionHierarchy<double>> hierarchy_;
 		size_t number_vertex_ = 0;
 
 		void BuildLinkToStop(size_t vertex_f, size_t vertex_s, double mass, int span_count, const std::string& name_bus);
@@ -119,16 +131,17 @@ namespace transport_router {
 
 	};
 
+	// Отвечает по таблице маршрутов из базы, если она есть, иначе по иерархии сжатия из базы,
+	// а без них ищет маршрут по запросу
 	class TransportRouter {
 	public:
-		explicit TransportRouter(InitGraph& catalog) : catalog_(catalog), router_(catalog_.GetGraph()) {
-		}
+		explicit TransportRouter(InitGraph& catalog);
 
 		std::optional<detail::BuildRoute> GetItemsRoute(const std::string& from_str, const std::string& to_str) const;
 
 	private:
 		InitGraph& catalog_;
-		graph::Router<double> router_;
+		std::variant<graph::DijkstraRouter<double>, graph::TableRouter<double>, graph::HierarchyRouter<double>> router_;
 	};
 
 }
\ No newline at end of file